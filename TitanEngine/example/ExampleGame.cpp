@@ -28,31 +28,24 @@ void ExampleGame::SetupScene() {
 
     // Create player entity
     playerEntity = entityManager.CreateEntity("Player");
-    auto playerTransform = std::make_shared<Titan::Transform>(glm::vec3(0.0f, 0.0f, 5.0f));
-    auto playerEntity_ptr = entityManager.GetEntity(playerEntity);
-    playerEntity_ptr->AddComponent<Titan::Transform>(playerTransform);
+    entityManager.AddComponent<Titan::Transform>(playerEntity, glm::vec3(0.0f, 0.0f, 5.0f));
 
     // Add physics to player
-    auto playerRigidBody = std::make_shared<Titan::RigidBody>();
-    playerRigidBody->mass = 1.0f;
-    playerRigidBody->useGravity = false;
-    playerEntity_ptr->AddComponent<Titan::RigidBody>(playerRigidBody);
+    Titan::RigidBody playerRigidBody;
+    playerRigidBody.mass = 1.0f;
+    playerRigidBody.useGravity = false;
     engine.GetPhysicsSystem().AddRigidBody(playerEntity, playerRigidBody);
 
     // Create cube entity
     cubeEntity = entityManager.CreateEntity("Cube");
-    auto cubeTransform = std::make_shared<Titan::Transform>(glm::vec3(0.0f, 0.0f, 0.0f));
-    auto cubeEntity_ptr = entityManager.GetEntity(cubeEntity);
-    cubeEntity_ptr->AddComponent<Titan::Transform>(cubeTransform);
+    entityManager.AddComponent<Titan::Transform>(cubeEntity, glm::vec3(0.0f, 0.0f, 0.0f));
 
     // Add renderable to cube
-    auto cubeRenderable = std::make_shared<Titan::Renderable>("assets/cube.mesh", "assets/default.mat");
-    cubeEntity_ptr->AddComponent<Titan::Renderable>(cubeRenderable);
+    entityManager.AddComponent<Titan::Renderable>(cubeEntity, "assets/cube.mesh", "assets/default.mat");
 
     // Add physics to cube
-    auto cubeRigidBody = std::make_shared<Titan::RigidBody>();
-    cubeRigidBody->mass = 2.0f;
-    cubeEntity_ptr->AddComponent<Titan::RigidBody>(cubeRigidBody);
+    Titan::RigidBody cubeRigidBody;
+    cubeRigidBody.mass = 2.0f;
     engine.GetPhysicsSystem().AddRigidBody(cubeEntity, cubeRigidBody);
 
     std::cout << "Scene setup complete!" << std::endl;
@@ -65,7 +58,7 @@ void ExampleGame::HandleInput() {
     auto playerEntity_ptr = engine.GetEntityManager().GetEntity(playerEntity);
     if (!playerEntity_ptr) return;
 
-    auto transform = playerEntity_ptr->GetComponent<Titan::Transform>();
+    auto transform = playerEntity_ptr.GetComponent<Titan::Transform>();
     if (!transform) return;
 
     const float moveSpeed = 5.0f;
@@ -86,7 +79,7 @@ void ExampleGame::HandleInput() {
 
     // Space to jump
     if (inputSystem.IsKeyPressed(Titan::KeyCode::Space)) {
-        auto rigidBody = playerEntity_ptr->GetComponent<Titan::RigidBody>();
+        auto rigidBody = playerEntity_ptr.GetComponent<Titan::RigidBody>();
         if (rigidBody) {
             rigidBody->velocity.y = 5.0f;
         }
@@ -99,10 +92,7 @@ void ExampleGame::HandleInput() {
 }
 
 void ExampleGame::UpdateGame(float deltaTime) {
-    auto cubeEntity_ptr = engine.GetEntityManager().GetEntity(cubeEntity);
-    if (!cubeEntity_ptr) return;
-
-    auto transform = cubeEntity_ptr->GetComponent<Titan::Transform>();
+    auto transform = engine.GetEntityManager().GetComponent<Titan::Transform>(cubeEntity);
     if (!transform) return;
 
     // Rotate cube
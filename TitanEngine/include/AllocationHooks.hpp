@@ -0,0 +1,69 @@
+#pragma once
+
+// Replaces the global operator new/delete with MemoryTracker's tracked
+// versions, so every heap allocation is counted per memory tag and thread.
+// Include in exactly one source file of the executable. The replacement is
+// process-wide with a shared engine library on Linux and macOS, and with a
+// static engine (TITAN_STATIC_ENGINE) everywhere.
+//
+// A Windows DLL keeps its own operator new, so engine memory freed by the
+// executable (or the reverse) would reach the wrong allocator.
+
+#include "Memory.hpp"
+#include "TitanExports.hpp"
+#include <new>
+
+#if defined(_WIN32) && !defined(TITAN_STATIC)
+#error "AllocationHooks.hpp needs the engine linked statically on Windows (TITAN_STATIC_ENGINE)"
+#endif
+
+#define TITAN_ALLOCATION_HOOKS 1
+
+void* operator new(std::size_t size) {
+    if (void* memory = Titan::MemoryTracker::Allocate(size)) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* memory = Titan::MemoryTracker::Allocate(size)) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* memory = Titan::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment))) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* memory = Titan::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment))) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Titan::MemoryTracker::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Titan::MemoryTracker::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Titan::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Titan::MemoryTracker::Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { Titan::MemoryTracker::Free(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { Titan::MemoryTracker::Free(memory); }
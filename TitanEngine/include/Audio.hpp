@@ -16,6 +16,12 @@ public:
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    const char* GetName() const override { return "Audio"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.WriteResource("Audio");
+    }
+
     virtual uint32_t LoadAudio(const std::string& audioPath) = 0;
     virtual void UnloadAudio(uint32_t audioID) = 0;
 
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Titan::Bench {
+
+// Keeps the compiler from discarding a value computed only for timing
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+struct Options {
+    std::string filter;          // substring of the benchmark names to run
+    int repetitions{30};         // timed samples per benchmark
+    double warmupMs{50.0};       // untimed running before the first sample
+    double minSampleMs{2.0};     // each sample repeats the operation this long
+};
+
+// Nanoseconds per item; the spread is the median absolute deviation
+struct Result {
+    std::string name;
+    uint64_t iterations{0};      // calls per sample
+    uint64_t itemsPerCall{1};
+    size_t samples{0};
+    double median{0.0};
+    double mad{0.0};
+    double p99{0.0};
+    double mean{0.0};
+    double min{0.0};
+};
+
+// Handed to each benchmark: set up outside Measure, time inside it
+class State {
+private:
+    const Options& options;
+    std::vector<Result>& results;
+    std::string name;
+
+public:
+    State(const Options& opts, std::vector<Result>& out, const std::string& benchmark)
+        : options(opts), results(out), name(benchmark) {}
+
+    // Warms up, sizes a sample to minSampleMs, then times repetitions
+    // samples of func. itemsPerCall divides the time when func handles a batch.
+    template<typename Func>
+    void Measure(Func&& func, uint64_t itemsPerCall = 1) {
+        using Clock = std::chrono::steady_clock;
+        auto elapsedNs = [](Clock::time_point start) {
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        };
+
+        uint64_t calls = 0;
+        auto warmupStart = Clock::now();
+        do {
+            func();
+            ++calls;
+        } while (elapsedNs(warmupStart) < options.warmupMs * 1e6);
+
+        double perCall = elapsedNs(warmupStart) / calls;
+        uint64_t iterations = std::max<uint64_t>(1, static_cast<uint64_t>(options.minSampleMs * 1e6 / perCall));
+
+        std::vector<double> samples;
+        for (int r = 0; r < options.repetitions; ++r) {
+            auto start = Clock::now();
+            for (uint64_t i = 0; i < iterations; ++i) func();
+            samples.push_back(elapsedNs(start) / (iterations * itemsPerCall));
+        }
+
+        Result result = Summarize(samples);
+        result.name = name;
+        result.iterations = iterations;
+        result.itemsPerCall = itemsPerCall;
+        results.push_back(result);
+    }
+
+    static Result Summarize(std::vector<double> samples) {
+        Result result;
+        if (samples.empty()) return result;
+        std::sort(samples.begin(), samples.end());
+
+        auto median = [](const std::vector<double>& sorted) {
+            size_t n = sorted.size();
+            return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+        };
+        result.samples = samples.size();
+        result.median = median(samples);
+        result.p99 = samples[std::min(samples.size() - 1, static_cast<size_t>(std::ceil(samples.size() * 0.99)) - 1)];
+        result.min = samples.front();
+        double sum = 0.0;
+        std::vector<double> deviations;
+        for (double sample : samples) {
+            sum += sample;
+            deviations.push_back(std::abs(sample - result.median));
+        }
+        std::sort(deviations.begin(), deviations.end());
+        result.mean = sum / samples.size();
+        result.mad = median(deviations);
+        return result;
+    }
+};
+
+class BenchmarkSuite {
+private:
+    struct Entry {
+        std::string name;
+        std::function<void(State&)> run;
+    };
+
+    static std::vector<Entry>& GetBenchmarks() {
+        static std::vector<Entry> benchmarks;
+        return benchmarks;
+    }
+
+public:
+    static void Register(const std::string& name, std::function<void(State&)> run) {
+        GetBenchmarks().push_back({ name, run });
+    }
+
+    static std::vector<std::string> GetNames() {
+        std::vector<std::string> names;
+        for (const Entry& entry : GetBenchmarks()) names.push_back(entry.name);
+        return names;
+    }
+
+    static std::vector<Result> RunAll(const Options& options) {
+        std::vector<Result> results;
+
+        std::cout << std::string(86, '=') << "\n";
+        std::cout << std::left << std::setw(36) << "benchmark" << std::right
+                  << std::setw(12) << "median ns" << std::setw(10) << "MAD" << std::setw(12) << "p99 ns"
+                  << std::setw(16) << "calls/sample" << "\n";
+        std::cout << std::string(86, '=') << "\n";
+
+        for (const Entry& entry : GetBenchmarks()) {
+            if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) continue;
+            size_t first = results.size();
+            State state(options, results, entry.name);
+            entry.run(state);
+            for (size_t i = first; i < results.size(); ++i) Print(std::cout, results[i]);
+        }
+        std::cout << std::string(86, '=') << "\n";
+        return results;
+    }
+
+    static void Print(std::ostream& out, const Result& result) {
+        out << std::left << std::setw(36) << result.name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << result.median << std::setw(10) << result.mad << std::setw(12) << result.p99
+            << std::setw(16) << result.iterations << std::defaultfloat << "\n";
+    }
+
+    // ========================================================================
+    // JSON results
+    // ========================================================================
+
+    static void WriteJson(std::ostream& out, const std::vector<Result>& results, const Options& options) {
+        out << "{\n  \"repetitions\": " << options.repetitions << ",\n  \"benchmarks\": [";
+        out << std::setprecision(10);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\""
+                << ", \"iterations\": " << r.iterations << ", \"items_per_call\": " << r.itemsPerCall
+                << ", \"samples\": " << r.samples << ", \"median_ns\": " << r.median << ", \"mad_ns\": " << r.mad
+                << ", \"p99_ns\": " << r.p99 << ", \"mean_ns\": " << r.mean << ", \"min_ns\": " << r.min << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    // Reads what WriteJson wrote: one flat object per benchmark
+    static bool ReadJson(std::istream& in, std::vector<Result>& results) {
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        std::string text = buffer.str();
+
+        size_t array = text.find("\"benchmarks\"");
+        if (array == std::string::npos) return false;
+        for (size_t open = text.find('{', array); open != std::string::npos; open = text.find('{', open + 1)) {
+            size_t close = text.find('}', open);
+            if (close == std::string::npos) return false;
+            std::string object = text.substr(open, close - open);
+
+            Result result;
+            size_t key = object.find("\"name\"");
+            size_t quote = key == std::string::npos ? key : object.find('"', object.find(':', key));
+            if (quote == std::string::npos) return false;
+            result.name = object.substr(quote + 1, object.find('"', quote + 1) - quote - 1);
+            result.median = ReadNumber(object, "median_ns");
+            result.mad = ReadNumber(object, "mad_ns");
+            result.p99 = ReadNumber(object, "p99_ns");
+            result.mean = ReadNumber(object, "mean_ns");
+            result.min = ReadNumber(object, "min_ns");
+            result.samples = static_cast<size_t>(ReadNumber(object, "samples"));
+            result.iterations = static_cast<uint64_t>(ReadNumber(object, "iterations"));
+            results.push_back(result);
+            open = close;
+        }
+        return true;
+    }
+
+    // ========================================================================
+    // Comparison
+    // ========================================================================
+
+    // A change counts when it exceeds both thresholdPercent and the combined
+    // MAD of the two runs. Returns the number of regressions.
+    static int Compare(std::ostream& out, const std::vector<Result>& baseline,
+                       const std::vector<Result>& current, double thresholdPercent) {
+        int regressions = 0;
+        out << std::left << std::setw(36) << "benchmark" << std::right
+            << std::setw(12) << "base ns" << std::setw(12) << "new ns" << std::setw(10) << "change" << "\n";
+
+        for (const Result& now : current) {
+            auto base = std::find_if(baseline.begin(), baseline.end(),
+                                     [&](const Result& r) { return r.name == now.name; });
+            out << std::left << std::setw(36) << now.name << std::right << std::fixed << std::setprecision(1);
+            if (base == baseline.end()) {
+                out << std::setw(12) << "-" << std::setw(12) << now.median << "       new\n";
+                continue;
+            }
+
+            double delta = now.median - base->median;
+            double percent = base->median > 0.0 ? delta / base->median * 100.0 : 0.0;
+            bool significant = std::abs(percent) > thresholdPercent && std::abs(delta) > base->mad + now.mad;
+            out << std::setw(12) << base->median << std::setw(12) << now.median
+                << std::setw(9) << std::showpos << percent << std::noshowpos << "%";
+            if (significant && delta > 0.0) {
+                out << "  SLOWER";
+                ++regressions;
+            } else if (significant) {
+                out << "  faster";
+            }
+            out << "\n";
+        }
+        for (const Result& old : baseline) {
+            bool kept = std::any_of(current.begin(), current.end(), [&](const Result& r) { return r.name == old.name; });
+            if (!kept) out << std::left << std::setw(36) << old.name << std::right << "  missing\n";
+        }
+        out << std::defaultfloat;
+        return regressions;
+    }
+
+private:
+    static double ReadNumber(const std::string& object, const std::string& key) {
+        size_t at = object.find("\"" + key + "\"");
+        if (at == std::string::npos) return 0.0;
+        return std::strtod(object.c_str() + object.find(':', at) + 1, nullptr);
+    }
+};
+
+// ============================================================================
+// Command line
+// ============================================================================
+
+// TitanBench [--filter text] [--repetitions n] [--warmup ms] [--min-sample ms]
+//            [--json path] [--list]
+// TitanBench --compare baseline.json current.json [--threshold percent]
+inline int RunMain(int argc, char** argv) {
+    Options options;
+    std::string jsonPath;
+    double threshold = 5.0;
+    std::vector<std::string> compare;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--repetitions" && hasValue) options.repetitions = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue) options.warmupMs = std::max(0.0, std::atof(argv[++i]));
+        else if (arg == "--min-sample" && hasValue) options.minSampleMs = std::max(0.01, std::atof(argv[++i]));
+        else if (arg == "--json" && hasValue) jsonPath = argv[++i];
+        else if (arg == "--threshold" && hasValue) threshold = std::atof(argv[++i]);
+        else if (arg == "--compare" && i + 2 < argc) {
+            compare.push_back(argv[++i]);
+            compare.push_back(argv[++i]);
+        } else if (arg == "--list") {
+            for (const std::string& name : BenchmarkSuite::GetNames()) std::cout << name << "\n";
+            return 0;
+        } else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            return 2;
+        }
+    }
+
+    if (!compare.empty()) {
+        std::vector<Result> baseline, current;
+        std::ifstream baseFile(compare[0]), currentFile(compare[1]);
+        if (!baseFile || !BenchmarkSuite::ReadJson(baseFile, baseline) ||
+            !currentFile || !BenchmarkSuite::ReadJson(currentFile, current)) {
+            std::cerr << "Failed to read benchmark results\n";
+            return 2;
+        }
+        int regressions = BenchmarkSuite::Compare(std::cout, baseline, current, threshold);
+        std::cout << regressions << " regression(s) beyond " << threshold << "%\n";
+        return regressions == 0 ? 0 : 1;
+    }
+
+    std::vector<Result> results = BenchmarkSuite::RunAll(options);
+    if (!jsonPath.empty()) {
+        std::ofstream file(jsonPath);
+        BenchmarkSuite::WriteJson(file, results, options);
+        if (!file) {
+            std::cerr << "Failed to write " << jsonPath << "\n";
+            return 2;
+        }
+        std::cout << "Wrote " << results.size() << " results to " << jsonPath << "\n";
+    }
+    return 0;
+}
+
+} // namespace Titan::Bench
+
+// Macro for registering benchmarks; the body receives Titan::Bench::State& state
+#define REGISTER_BENCHMARK(name, label) \
+    void Bench_##name##_func(Titan::Bench::State& state); \
+    namespace { \
+        struct Bench_##name##_Reg { \
+            Bench_##name##_Reg() { \
+                Titan::Bench::BenchmarkSuite::Register(label, &Bench_##name##_func); \
+            } \
+        } bench_##name##_instance; \
+    } \
+    void Bench_##name##_func(Titan::Bench::State& state)
@@ -7,6 +7,20 @@
 #include <unordered_map>
 #include <functional>
 #include <queue>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <new>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <typeindex>
+#include <stdexcept>
+#include <type_traits>
+#include <bitset>
+#include <array>
+#include <algorithm>
+#include <initializer_list>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -24,6 +38,25 @@ using ComponentID = uint32_t;
 using EventID = uint32_t;
 using invalid_entity = std::integral_constant<EntityID, 0>;
 
+// EntityIDs are generational handles: the low bits index a slot in the
+// EntityManager and the high bits hold the slot's generation, which is bumped
+// every time the slot is reused so stale handles can be detected. Handles use
+// 31 bits so they stay non-negative when passed through the C and Lua APIs.
+constexpr uint32_t ENTITY_INDEX_BITS = 20;
+constexpr uint32_t ENTITY_GENERATION_BITS = 11;
+constexpr uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr uint32_t ENTITY_GENERATION_MASK = (1u << ENTITY_GENERATION_BITS) - 1;
+
+constexpr uint32_t GetEntityIndex(EntityID id) { return id & ENTITY_INDEX_MASK; }
+constexpr uint32_t GetEntityGeneration(EntityID id) { return (id >> ENTITY_INDEX_BITS) & ENTITY_GENERATION_MASK; }
+constexpr EntityID MakeEntityID(uint32_t index, uint32_t generation) {
+    return ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+}
+
+// Set on placeholder IDs handed out by EntityCommandBuffer::CreateEntity
+constexpr EntityID ENTITY_PENDING_BIT = 1u << 31;
+constexpr bool IsPendingEntity(EntityID id) { return (id & ENTITY_PENDING_BIT) != 0; }
+
 // ============================================================================
 // Base Classes
 // ============================================================================
@@ -34,12 +67,78 @@ public:
     virtual ComponentID GetComponentID() const = 0;
 };
 
+// Components made only of plain values (no strings, containers or owning
+// pointers) are copied with memcpy by WorldSnapshot. Specialise to opt in,
+// deriving from PlainComponentMembers with the type of every data member.
+//
+// Components are polymorphic, so that memcpy also copies the Component vptr.
+// It is only ever copied between objects of the same type, so the pointer
+// written equals the one already there; this assumes the usual ABI layout of
+// one vptr and no other hidden state (no virtual bases, no further virtuals
+// that add any), and a destructor with nothing to do beyond the members.
+template<typename T>
+struct IsPlainComponent : std::false_type {};
+
+template<typename... Members>
+struct PlainComponentMembers : std::true_type {
+    static_assert((std::is_trivially_copyable_v<Members> && ...),
+                  "Plain component members must be trivially copyable");
+    static_assert((std::is_trivially_destructible_v<Members> && ...),
+                  "Plain component members must be trivially destructible");
+};
+
+// Components and engine resources a system touches during Update(). The
+// SystemScheduler runs systems whose accesses do not conflict in parallel.
+class TITAN_API SystemAccess {
+private:
+    std::vector<ComponentID> readComponents;
+    std::vector<ComponentID> writeComponents;
+    std::vector<std::string> readResources;
+    std::vector<std::string> writeResources;
+    bool exclusive{false};
+    bool mainThread{false};
+
+public:
+    template<typename T>
+    SystemAccess& Read() {
+        readComponents.push_back(T::StaticID());
+        return *this;
+    }
+
+    template<typename T>
+    SystemAccess& Write() {
+        writeComponents.push_back(T::StaticID());
+        return *this;
+    }
+
+    SystemAccess& ReadResource(const std::string& name);
+    SystemAccess& WriteResource(const std::string& name);
+
+    // Conflicts with every other system; used when access is unknown
+    SystemAccess& Exclusive();
+    // Must run on the thread that called Engine::Run (e.g. GL calls)
+    SystemAccess& MainThreadOnly();
+
+    bool IsExclusive() const { return exclusive; }
+    bool IsMainThreadOnly() const { return mainThread; }
+
+    // True if running both systems at the same time could race
+    bool ConflictsWith(const SystemAccess& other) const;
+};
+
 class ISystem {
 public:
     virtual ~ISystem() = default;
     virtual void Initialize() {}
     virtual void Update(float deltaTime) = 0;
     virtual void Shutdown() {}
+
+    // Stable label for profiler zones; return a string literal
+    virtual const char* GetName() const { return "System"; }
+
+    // Systems that do not declare their access are treated as exclusive and
+    // keep their place in the sequential update order.
+    virtual void DeclareAccess(SystemAccess& access) const { access.Exclusive(); }
 };
 
 class Event {
@@ -70,8 +169,16 @@ public:
     glm::vec3 GetForward() const;
     glm::vec3 GetRight() const;
     glm::vec3 GetUp() const;
+
+    // Blend between two simulation ticks for rendering (alpha from
+    // Engine::GetInterpolationAlpha); angles take the shortest way round
+    static Transform Interpolate(const Transform& previous, const Transform& current, float alpha);
 };
 
+template<> struct IsPlainComponent<Transform>
+    : PlainComponentMembers<decltype(Transform::position), decltype(Transform::rotation),
+                            decltype(Transform::scale)> {};
+
 // ============================================================================
 // Physics Component (Placeholder for future physics engine integration)
 // ============================================================================
@@ -93,6 +200,11 @@ public:
     void SetVelocity(const glm::vec3& vel);
 };
 
+template<> struct IsPlainComponent<RigidBody>
+    : PlainComponentMembers<decltype(RigidBody::velocity), decltype(RigidBody::acceleration),
+                            decltype(RigidBody::mass), decltype(RigidBody::useGravity),
+                            decltype(RigidBody::isKinematic)> {};
+
 // ============================================================================
 // Renderable Component
 // ============================================================================
@@ -135,85 +247,965 @@ public:
 };
 
 // ============================================================================
-// Entity
+// Component Storage (Archetypes)
 // ============================================================================
 
-class Entity {
+constexpr size_t MAX_COMPONENT_TYPES = 128;
+
+// One bit per registered component type; the signature of an archetype
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+// Maps the stable ComponentIDs (saved and sent over the network) to dense
+// indices used for signature bits and column lookups. Indices are handed out
+// on first use and shared by every EntityManager and module in the process.
+class TITAN_API ComponentRegistry {
+public:
+    // Registers the ID on first call; throws past MAX_COMPONENT_TYPES types
+    static uint32_t GetIndex(ComponentID id);
+    static size_t GetCount();
+};
+
+// Dense index of T, looked up once per type and module
+template<typename T>
+uint32_t ComponentIndex() {
+    static const uint32_t index = ComponentRegistry::GetIndex(std::remove_cv_t<T>::StaticID());
+    return index;
+}
+
+template<typename... Ts>
+ComponentMask MakeComponentMask() {
+    ComponentMask mask;
+    (mask.set(ComponentIndex<Ts>()), ...);
+    return mask;
+}
+
+// Type-erased description of a component type. Archetype chunks use it to move
+// and destroy components without knowing their concrete type.
+struct ComponentTypeInfo {
+    ComponentID id{0};
+    uint32_t index{0};  // ComponentIndex<T>()
+    size_t size{0};
+    size_t alignment{0};
+    bool plain{false};  // IsPlainComponent<T>
+    void (*moveConstruct)(void* dst, void* src){nullptr};
+    void (*destroy)(void* ptr){nullptr};
+    // Null when T cannot be copied
+    void (*copyConstruct)(void* dst, const void* src){nullptr};
+    void (*copyAssign)(void* dst, const void* src){nullptr};
+
+    template<typename T>
+    static ComponentTypeInfo Of() {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        ComponentTypeInfo info;
+        info.id = T::StaticID();
+        info.index = ComponentIndex<T>();
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.plain = IsPlainComponent<T>::value;
+        info.moveConstruct = [](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); };
+        info.destroy = [](void* ptr) { static_cast<T*>(ptr)->~T(); };
+        if constexpr (std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>) {
+            info.copyConstruct = [](void* dst, const void* src) { new (dst) T(*static_cast<const T*>(src)); };
+            info.copyAssign = [](void* dst, const void* src) { *static_cast<T*>(dst) = *static_cast<const T*>(src); };
+        }
+        return info;
+    }
+};
+
+// Fixed-size block allocator for archetype chunks, shared by every archetype
+// of an EntityManager. Released chunks go on an intrusive free list and are
+// handed out again before new memory is requested, so entity churn in steady
+// state never reaches the system allocator.
+class TITAN_API ChunkPool {
+public:
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+    static constexpr size_t BLOCK_ALIGNMENT = 64;
+
+    struct Stats {
+        uint64_t systemAllocations{0};  // blocks obtained from operator new
+        uint64_t reuses{0};             // allocations served from the free list
+        uint64_t releases{0};           // blocks returned to the pool
+        size_t blocksInUse{0};
+        size_t blocksFree{0};
+    };
+
+private:
+    uint8_t* freeHead{nullptr};  // next pointer stored in the first bytes of each free block
+    Stats stats;
+
+public:
+    ChunkPool() = default;
+    ~ChunkPool();
+
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool& operator=(const ChunkPool&) = delete;
+
+    uint8_t* Allocate();
+    void Release(uint8_t* block);
+
+    // Frees every block on the free list
+    void Trim();
+
+    const Stats& GetStats() const { return stats; }
+    size_t GetReservedBytes() const { return (stats.blocksInUse + stats.blocksFree) * BLOCK_SIZE; }
+};
+
+// An archetype owns every entity that has exactly the same set of components.
+// Entities are packed into fixed-size chunks and each chunk stores one
+// contiguous array per component type (SoA), so iterating a component type is
+// a linear sweep. Rows are kept dense: removing an entity moves the last row
+// into the hole.
+class TITAN_API Archetype {
+public:
+    static constexpr size_t CHUNK_SIZE = ChunkPool::BLOCK_SIZE;
+    static constexpr size_t CHUNK_ALIGNMENT = ChunkPool::BLOCK_ALIGNMENT;
+
+    struct Chunk {
+        uint8_t* data{nullptr};
+        uint32_t count{0};
+    };
+
+private:
+    std::vector<ComponentID> signature;         // Sorted component IDs
+    ComponentMask mask;                          // Same set, as registry bits
+    std::array<int16_t, MAX_COMPONENT_TYPES> columnByIndex;  // -1 where absent
+    std::vector<ComponentTypeInfo> types;        // Parallel to signature
+    std::vector<size_t> columnOffsets;           // Byte offset of each column inside a chunk
+    size_t chunkBytes{CHUNK_SIZE};
+    uint32_t chunkCapacity{0};
+    std::vector<Chunk> chunks;
+    uint32_t entityCount{0};
+    ChunkPool* pool{nullptr};  // null, or rows too large for a pool block: operator new
+
+    // Change detection: last version each column of each chunk was written /
+    // added at, indexed [chunk * types.size() + column]
+    std::vector<uint32_t> changedVersions;
+    std::vector<uint32_t> addedVersions;
+    const std::atomic<uint32_t>* versionClock{nullptr};  // EntityManager::changeVersion
+
+    // Cached transitions to neighbouring archetypes, keyed by component index
+    std::unordered_map<uint32_t, Archetype*> addEdges;
+    std::unordered_map<uint32_t, Archetype*> removeEdges;
+
     friend class EntityManager;
+    friend class WorldSnapshot;
+
+public:
+    explicit Archetype(std::vector<ComponentTypeInfo> componentTypes, ChunkPool* chunkPool = nullptr,
+                       const std::atomic<uint32_t>* changeVersion = nullptr);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    const std::vector<ComponentID>& GetSignature() const { return signature; }
+    const ComponentMask& GetMask() const { return mask; }
+    const std::vector<ComponentTypeInfo>& GetComponentTypes() const { return types; }
+    uint32_t GetEntityCount() const { return entityCount; }
+    uint32_t GetChunkCapacity() const { return chunkCapacity; }
+    size_t GetChunkCount() const { return chunks.size(); }
+    const Chunk& GetChunk(size_t index) const { return chunks[index]; }
+
+    // Column index of a component type, or -1 if the archetype does not have it
+    int FindColumn(ComponentID id) const;
+    bool HasComponent(ComponentID id) const { return FindColumn(id) >= 0; }
+
+    // Same by ComponentIndex, in O(1)
+    int FindColumnByIndex(uint32_t index) const { return columnByIndex[index]; }
+    bool HasComponentIndex(uint32_t index) const { return mask.test(index); }
+
+    EntityID* GetEntities(const Chunk& chunk) const { return reinterpret_cast<EntityID*>(chunk.data); }
+    void* GetColumn(const Chunk& chunk, int column) const { return chunk.data + columnOffsets[column]; }
+    void* GetComponent(uint32_t row, int column) const;
+    EntityID GetEntity(uint32_t row) const;
+
+    // Versions are compared against ChangeCursor windows; see View::Changed
+    uint32_t GetChangedVersion(size_t chunk, int column) const { return changedVersions[chunk * types.size() + column]; }
+    uint32_t GetAddedVersion(size_t chunk, int column) const { return addedVersions[chunk * types.size() + column]; }
+    void MarkChanged(size_t chunk, int column) { changedVersions[chunk * types.size() + column] = CurrentVersion(); }
+    void MarkRowChanged(uint32_t row, int column) { MarkChanged(row / chunkCapacity, column); }
+    void MarkRowAdded(uint32_t row, int column);
+
+    // Appends a row for the entity. Component storage is left uninitialised.
+    uint32_t AllocateRow(EntityID id);
+
+    // Removes a row by moving the last row into it. Returns the entity that was
+    // moved into the row, or invalid_entity if no move was needed. One empty
+    // chunk is kept as slack; any further empty chunk goes back to the pool.
+    EntityID RemoveRow(uint32_t row, bool destroyComponents);
+
+private:
+    void DestroyAll();
+    // Sets an emptied archetype to rows uninitialised rows, all stamped as added
+    void ResizeRows(uint32_t rows);
+    uint32_t CurrentVersion() const { return versionClock ? versionClock->load(std::memory_order_relaxed) : 1; }
+    void MergeVersions(size_t targetChunk, const Archetype& source, size_t sourceChunk, int sourceColumn, int targetColumn);
+    uint8_t* AllocateChunk();
+    void FreeChunk(uint8_t* data);
+};
+
+// ============================================================================
+// Views (Cached Multi-Component Queries)
+// ============================================================================
+
+// Set of archetypes matching a component query. Owned by the EntityManager,
+// which appends newly created archetypes to every matching cache, so adding or
+// removing components never requires a rescan.
+struct QueryCache {
+    struct Match {
+        Archetype* archetype{nullptr};
+        std::vector<int> columns;  // Column per queried type, in query order
+    };
+
+    std::vector<uint32_t> components;  // Component indices, in query order
+    ComponentMask mask;
+    std::vector<Match> matches;
+
+    bool TryAdd(Archetype* archetype);
+};
+
+// Iterates every entity that has all of Ts, yielding references to its
+// components:
+//
+//     for (auto [transform, body] : entityManager.GetView<Transform, RigidBody>()) { ... }
+//
+// Visiting a chunk through a non-const T marks that column of the chunk as
+// changed; use const T for read-only access. Changed<T>(since) and
+// Added<T>(since) return a copy of the view that skips chunks where T has not
+// been written / added after version `since` (see ChangeCursor). Filters work
+// per chunk, so a filtered view may still yield some unchanged entities.
+//
+// Structural changes (creating/destroying entities, adding/removing
+// components) invalidate iterators of all views.
+template<typename... Ts>
+class View {
+    static_assert(sizeof...(Ts) > 0, "View requires at least one component type");
+
+public:
+    static constexpr size_t MAX_FILTERS = 4;
+
+private:
+    struct Filter {
+        uint32_t component{0};  // ComponentIndex
+        uint32_t since{0};
+        bool added{false};
+    };
+
+    const QueryCache* cache{nullptr};
+    Filter filters[MAX_FILTERS];
+    size_t filterCount{0};
+
+    template<size_t... Is>
+    static std::tuple<Ts*...> GetArrays(const QueryCache::Match& match, const Archetype::Chunk& chunk,
+                                         std::index_sequence<Is...>) {
+        return std::make_tuple(static_cast<Ts*>(match.archetype->GetColumn(chunk, match.columns[Is]))...);
+    }
+
+    template<typename T>
+    static void MarkIfWritable(const QueryCache::Match& match, size_t chunk, int column) {
+        if constexpr (!std::is_const_v<T>) {
+            match.archetype->MarkChanged(chunk, column);
+        }
+    }
+
+    template<size_t... Is>
+    static void MarkWritten(const QueryCache::Match& match, size_t chunk, std::index_sequence<Is...>) {
+        (MarkIfWritable<Ts>(match, chunk, match.columns[Is]), ...);
+    }
+
+    bool Accepts(const QueryCache::Match& match, size_t chunk) const {
+        for (size_t f = 0; f < filterCount; ++f) {
+            int column = match.archetype->FindColumnByIndex(filters[f].component);
+            if (column < 0) return false;
+            uint32_t version = filters[f].added ? match.archetype->GetAddedVersion(chunk, column)
+                                                : match.archetype->GetChangedVersion(chunk, column);
+            if (version <= filters[f].since) return false;
+        }
+        return true;
+    }
+
+    // Calls func(match, chunkIndex) for each non-empty chunk that passes the filters
+    template<typename Func>
+    void ForEachChunk(Func&& func) const {
+        for (const auto& current : cache->matches) {
+            Archetype* archetype = current.archetype;
+            for (size_t c = 0; c < archetype->GetChunkCount(); ++c) {
+                if (archetype->GetChunk(c).count == 0) break;
+                if (Accepts(current, c)) func(current, c);
+            }
+        }
+    }
+
+    View WithFilter(uint32_t component, uint32_t since, bool added) const {
+        if (filterCount == MAX_FILTERS) {
+            throw std::runtime_error("Too many filters on view");
+        }
+        View filtered = *this;
+        filtered.filters[filtered.filterCount++] = Filter{ component, since, added };
+        return filtered;
+    }
+
+public:
+    class Iterator {
+    private:
+        const View* view{nullptr};
+        size_t match{0};
+        size_t chunk{0};
+        uint32_t row{0};
+        uint32_t count{0};
+        std::tuple<Ts*...> arrays;
+
+        // Moves to the first row of the next accepted non-empty chunk at or
+        // after (match, chunk). Non-empty chunks always form a prefix of an
+        // archetype's chunk list.
+        void Seek() {
+            const auto& matches = view->cache->matches;
+            while (match < matches.size()) {
+                const auto& current = matches[match];
+                Archetype* archetype = current.archetype;
+                for (; chunk < archetype->GetChunkCount() && archetype->GetChunk(chunk).count > 0; ++chunk) {
+                    if (!view->Accepts(current, chunk)) continue;
+                    const auto& c = archetype->GetChunk(chunk);
+                    MarkWritten(current, chunk, std::index_sequence_for<Ts...>{});
+                    arrays = GetArrays(current, c, std::index_sequence_for<Ts...>{});
+                    count = c.count;
+                    row = 0;
+                    return;
+                }
+                ++match;
+                chunk = 0;
+            }
+            chunk = 0;
+            row = 0;
+            count = 0;
+        }
+
+        template<size_t... Is>
+        std::tuple<Ts&...> Get(std::index_sequence<Is...>) const {
+            return std::tuple<Ts&...>(std::get<Is>(arrays)[row]...);
+        }
+
+    public:
+        Iterator(const View* owner, size_t startMatch)
+            : view(owner), match(startMatch) {
+            Seek();
+        }
+
+        std::tuple<Ts&...> operator*() const { return Get(std::index_sequence_for<Ts...>{}); }
+
+        EntityID GetEntity() const {
+            const auto& current = view->cache->matches[match];
+            return current.archetype->GetEntities(current.archetype->GetChunk(chunk))[row];
+        }
+
+        Iterator& operator++() {
+            if (++row >= count) {
+                ++chunk;
+                Seek();
+            }
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return match == other.match && chunk == other.chunk && row == other.row;
+        }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    View() = default;
+    explicit View(const QueryCache* queryCache) : cache(queryCache) {}
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, cache->matches.size()); }
+
+    template<typename T>
+    View Changed(uint32_t since) const { return WithFilter(ComponentIndex<T>(), since, false); }
+
+    template<typename T>
+    View Added(uint32_t since) const { return WithFilter(ComponentIndex<T>(), since, true); }
+
+    // Calls func(EntityID, Ts&...) chunk by chunk; the fastest way to walk a view
+    template<typename Func>
+    void Each(Func&& func) const {
+        ForEachChunk([&](const QueryCache::Match& current, size_t c) {
+            VisitChunk(current, c, func);
+        });
+    }
+
+    // Number of non-empty chunks the view visits. Together with EachInChunks
+    // this lets JobSystem::ParallelFor split a view across threads.
+    size_t GetChunkCount() const {
+        size_t total = 0;
+        ForEachChunk([&total](const QueryCache::Match&, size_t) { total++; });
+        return total;
+    }
+
+    // Like Each, restricted to visited chunks [first, last) in view order
+    template<typename Func>
+    void EachInChunks(size_t first, size_t last, Func&& func) const {
+        size_t index = 0;
+        ForEachChunk([&](const QueryCache::Match& current, size_t c) {
+            if (index >= first && index < last) VisitChunk(current, c, func);
+            index++;
+        });
+    }
+
+    size_t Size() const {
+        size_t total = 0;
+        if (filterCount == 0) {
+            for (const auto& current : cache->matches) total += current.archetype->GetEntityCount();
+        } else {
+            ForEachChunk([&total](const QueryCache::Match& current, size_t c) {
+                total += current.archetype->GetChunk(c).count;
+            });
+        }
+        return total;
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+private:
+    template<typename Func>
+    static void VisitChunk(const QueryCache::Match& current, size_t c, Func& func) {
+        Archetype* archetype = current.archetype;
+        const auto& chunk = archetype->GetChunk(c);
+        MarkWritten(current, c, std::index_sequence_for<Ts...>{});
+        EachInChunk(archetype->GetEntities(chunk), chunk.count,
+                    GetArrays(current, chunk, std::index_sequence_for<Ts...>{}),
+                    func, std::index_sequence_for<Ts...>{});
+    }
+
+    template<typename Func, size_t... Is>
+    static void EachInChunk(const EntityID* ids, uint32_t count, const std::tuple<Ts*...>& arrays,
+                            Func& func, std::index_sequence<Is...>) {
+        for (uint32_t i = 0; i < count; ++i) {
+            func(ids[i], std::get<Is>(arrays)[i]...);
+        }
+    }
+};
+
+// ============================================================================
+// Entity
+// ============================================================================
+
+class EntityManager;
 
+// Lightweight handle to an entity owned by an EntityManager. Component data
+// lives in the manager's archetype chunks; pointers returned by GetComponent
+// stay valid until the entity's component set changes or it is destroyed.
+class TITAN_API Entity {
 private:
+    EntityManager* manager{nullptr};
     EntityID id{invalid_entity::value};
-    std::string name;
-    std::unordered_map<ComponentID, std::shared_ptr<Component>> components;
-    bool active{true};
 
 public:
     Entity() = default;
-    explicit Entity(EntityID entityID, const std::string& entityName)
-        : id(entityID), name(entityName) {}
+    Entity(EntityManager* entityManager, EntityID entityID)
+        : manager(entityManager), id(entityID) {}
 
     EntityID GetID() const { return id; }
-    const std::string& GetName() const { return name; }
-    void SetName(const std::string& newName) { name = newName; }
-    bool IsActive() const { return active; }
-    void SetActive(bool state) { active = state; }
+    bool IsValid() const;
+    explicit operator bool() const { return IsValid(); }
+
+    const std::string& GetName() const;
+    void SetName(const std::string& newName);
+    bool IsActive() const;
+    void SetActive(bool state);
+
+    template<typename T, typename... Args>
+    T& AddComponent(Args&&... args);
 
     template<typename T>
-    void AddComponent(std::shared_ptr<T> component) {
-        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
-        components[T::StaticID()] = component;
-    }
+    T* GetComponent();
 
     template<typename T>
-    std::shared_ptr<T> GetComponent() {
-        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
-        auto it = components.find(T::StaticID());
-        return (it != components.end()) ? std::static_pointer_cast<T>(it->second) : nullptr;
-    }
+    bool HasComponent() const;
 
     template<typename T>
-    bool HasComponent() const {
+    void RemoveComponent();
+};
+
+// ============================================================================
+// Entity Command Buffer
+// ============================================================================
+
+// Records structural changes (create/destroy entities, add/remove components)
+// so they can be made while views are being iterated or from worker threads,
+// then applies them in one batch. Component values are constructed into the
+// buffer's own storage at record time and moved into chunks on Apply.
+//
+// CreateEntity returns a placeholder ID that is only meaningful to later
+// commands in the same buffer; it is replaced by the real ID on Apply.
+// Commands that target entities which died in the meantime are skipped.
+class TITAN_API EntityCommandBuffer {
+private:
+    enum class CommandType : uint8_t { CreateEntity, DestroyEntity, AddComponent, RemoveComponent };
+
+    struct Command {
+        CommandType type;
+        EntityID entity{invalid_entity::value};
+        ComponentTypeInfo info;    // id is the component for Add/Remove
+        void* payload{nullptr};    // constructed component value for Add
+        uint32_t nameIndex{0};     // into names, for CreateEntity
+    };
+
+    // Payloads never move once constructed, so they live in fixed blocks
+    struct PayloadBlock {
+        uint8_t* data{nullptr};
+        size_t size{0};
+        size_t used{0};
+    };
+
+    static constexpr size_t PAYLOAD_BLOCK_SIZE = 4096;
+
+    std::vector<Command> commands;
+    std::vector<std::string> names;
+    std::vector<PayloadBlock> blocks;
+    size_t currentBlock{0};
+    uint32_t pendingCount{0};
+    std::vector<EntityID> createdEntities;  // pending index -> real ID during Apply
+
+public:
+    EntityCommandBuffer() = default;
+    ~EntityCommandBuffer();
+
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    EntityID CreateEntity(const std::string& name = "Entity");
+    void DestroyEntity(EntityID id);
+
+    template<typename T, typename... Args>
+    void AddComponent(EntityID id, Args&&... args) {
         static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
-        return components.find(T::StaticID()) != components.end();
+        Command command;
+        command.type = CommandType::AddComponent;
+        command.entity = id;
+        command.info = ComponentTypeInfo::Of<T>();
+        command.payload = AllocatePayload(sizeof(T), alignof(T));
+        new (command.payload) T(std::forward<Args>(args)...);
+        commands.push_back(command);
     }
 
     template<typename T>
-    void RemoveComponent() {
+    void RemoveComponent(EntityID id) {
         static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
-        components.erase(T::StaticID());
+        Command command;
+        command.type = CommandType::RemoveComponent;
+        command.entity = id;
+        command.info = ComponentTypeInfo::Of<T>();
+        commands.push_back(command);
     }
 
-    const auto& GetAllComponents() const { return components; }
+    // Plays every command back in record order, then clears the buffer
+    void Apply(EntityManager& manager);
+
+    // Drops every recorded command without applying it
+    void Clear();
+
+    bool IsEmpty() const { return commands.empty(); }
+    size_t GetCommandCount() const { return commands.size(); }
+
+private:
+    void* AllocatePayload(size_t size, size_t alignment);
+    EntityID Resolve(EntityID id) const;
 };
 
 // ============================================================================
 // Entity Manager
 // ============================================================================
 
+// One slot of the dense entity table. A slot is free when archetype is null.
+struct EntityRecord {
+    std::string name;
+    bool active{true};
+    Archetype* archetype{nullptr};
+    uint32_t row{0};
+    uint32_t generation{0};
+    uint32_t nextFree{0};
+};
+
 class TITAN_API EntityManager {
 private:
-    std::unordered_map<EntityID, std::shared_ptr<Entity>> entities;
-    EntityID nextID{1};
+    // Slot 0 is reserved so that invalid_entity never refers to a live entity
+    std::vector<EntityRecord> slots;
+    uint32_t freeHead{0};   // FIFO free list, spreads generation reuse across slots
+    uint32_t freeTail{0};
+    size_t entityCount{0};
+
+    ChunkPool chunkPool;  // declared before archetypes so it outlives them
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<ComponentMask, Archetype*> archetypeLookup;
+    // Transparent so GetView can look a query up without building a vector
+    struct QueryKeyLess {
+        using is_transparent = void;
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+        }
+    };
+    std::map<std::vector<uint32_t>, std::unique_ptr<QueryCache>, QueryKeyLess> queryCaches;
+    std::mutex queryCacheMutex;  // systems may request views from worker threads
+    Archetype* emptyArchetype{nullptr};
+
+    // One command buffer per recording thread, applied by FlushCommands()
+    std::vector<std::unique_ptr<EntityCommandBuffer>> commandBuffers;
+    std::unordered_map<std::thread::id, EntityCommandBuffer*> threadCommandBuffers;
+    std::mutex commandBufferMutex;
+    uint64_t serial;  // identifies this manager in the per-thread buffer cache
+
+    // Change detection clock; never rewound, not even by Clear()
+    std::atomic<uint32_t> changeVersion{1};
+
+    // Bumped by anything that changes which entities exist, their component
+    // sets, rows, names or active flags. Lets WorldSnapshot take deltas.
+    uint64_t structuralVersion{0};
+
+    friend class EntityCommandBuffer;
+    friend class WorldSnapshot;
 
 public:
+    EntityManager();
+    ~EntityManager();
+
+    EntityManager(const EntityManager&) = delete;
+    EntityManager& operator=(const EntityManager&) = delete;
+
     EntityID CreateEntity(const std::string& name = "Entity");
     void DestroyEntity(EntityID id);
-    std::shared_ptr<Entity> GetEntity(EntityID id);
-    const auto& GetAllEntities() const { return entities; }
+    Entity GetEntity(EntityID id);
+    bool IsAlive(EntityID id) const { return FindRecord(id) != nullptr; }
+    size_t GetEntityCount() const { return entityCount; }
     void Clear();
+
+    // Grows the slot table up front so spawning count entities does not reallocate it
+    void ReserveEntities(size_t count);
+    const ChunkPool& GetChunkPool() const { return chunkPool; }
+
+    // Deferred structural changes. Systems record into the calling thread's
+    // buffer during Update; the engine applies every buffer once per frame,
+    // after all systems have run, in the order the buffers were first used.
+    EntityCommandBuffer& GetCommandBuffer();
+    void FlushCommands();
+
+    // Component writes are stamped with the current change version. Advancing
+    // it starts a new window; returns the version that window replaced.
+    uint32_t AdvanceChangeVersion() { return changeVersion.fetch_add(1); }
+    uint32_t GetChangeVersion() const { return changeVersion.load(); }
+
+    // Calls func(EntityID) for every live entity in slot order
+    template<typename Func>
+    void ForEachEntity(Func&& func) const {
+        for (uint32_t index = 1; index < slots.size(); ++index) {
+            if (slots[index].archetype) {
+                func(MakeEntityID(index, slots[index].generation));
+            }
+        }
+    }
+
+    const std::string& GetName(EntityID id) const;
+    void SetName(EntityID id, const std::string& name);
+    bool IsActive(EntityID id) const;
+    void SetActive(EntityID id, bool active);
+
+    // Component access
+    template<typename T, typename... Args>
+    T& AddComponent(EntityID id, Args&&... args) {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        T value(std::forward<Args>(args)...);
+        bool replaced = false;
+        void* storage = AddComponentStorage(id, ComponentTypeInfo::Of<T>(), replaced);
+        if (replaced) {
+            return *static_cast<T*>(storage) = std::move(value);
+        }
+        return *new (storage) T(std::move(value));
+    }
+
+    // Marks the component as changed; use ReadComponent for read-only access
+    template<typename T>
+    T* GetComponent(EntityID id) {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        return static_cast<T*>(GetComponentStorage(id, ComponentIndex<T>()));
+    }
+
+    template<typename T>
+    const T* ReadComponent(EntityID id) const {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        return static_cast<const T*>(ReadComponentStorage(id, ComponentIndex<T>()));
+    }
+
+    // Change version of T on the entity's chunk; 0 if the entity has no T
+    template<typename T>
+    uint32_t GetChangedVersion(EntityID id) const {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        return GetComponentVersion(id, ComponentIndex<T>());
+    }
+
+    template<typename T>
+    bool HasComponent(EntityID id) const {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        const EntityRecord* record = FindRecord(id);
+        return record && record->archetype->HasComponentIndex(ComponentIndex<T>());
+    }
+
+    template<typename T>
+    void RemoveComponent(EntityID id) {
+        static_assert(std::is_base_of_v<Component, T>, "T must inherit from Component");
+        RemoveComponentStorage(id, ComponentIndex<T>());
+    }
+
+    // Component set of the entity (its archetype's mask); empty if it is dead
+    ComponentMask GetSignature(EntityID id) const {
+        const EntityRecord* record = FindRecord(id);
+        return record ? record->archetype->GetMask() : ComponentMask();
+    }
+
+    // True if the entity has every component in mask (see MakeComponentMask)
+    bool HasComponents(EntityID id, const ComponentMask& mask) const {
+        const EntityRecord* record = FindRecord(id);
+        return record && (record->archetype->GetMask() & mask) == mask;
+    }
+
+    // Cached view over every entity that has all of Ts. The match set is
+    // built once per distinct query and kept up to date as archetypes appear.
+    template<typename... Ts>
+    View<Ts...> GetView() {
+        static_assert((std::is_base_of_v<Component, Ts> && ...), "Ts must inherit from Component");
+        return View<Ts...>(GetQueryCache({ ComponentIndex<Ts>()... }));
+    }
+
+    // Calls func(EntityID, Ts&...) for every entity that has all of Ts. The
+    // component set of entities must not change while iterating.
+    template<typename... Ts, typename Func>
+    void Each(Func&& func) {
+        GetView<Ts...>().Each(std::forward<Func>(func));
+    }
+
+    const std::vector<std::unique_ptr<Archetype>>& GetArchetypes() const { return archetypes; }
+
+private:
+    // O(1) handle validation: index in range, slot in use and generation matches
+    EntityRecord* FindRecord(EntityID id) {
+        uint32_t index = GetEntityIndex(id);
+        if (index == 0 || index >= slots.size()) return nullptr;
+        EntityRecord& record = slots[index];
+        return (record.archetype && record.generation == GetEntityGeneration(id)) ? &record : nullptr;
+    }
+
+    const EntityRecord* FindRecord(EntityID id) const {
+        return const_cast<EntityManager*>(this)->FindRecord(id);
+    }
+
+    void UpdateMovedRow(EntityID moved, uint32_t row) {
+        if (moved != invalid_entity::value) slots[GetEntityIndex(moved)].row = row;
+    }
+
+    Archetype* GetOrCreateArchetype(std::vector<ComponentTypeInfo> types);
+    void MoveEntity(EntityID id, EntityRecord& record, Archetype* target);
+
+    void* AddComponentStorage(EntityID id, const ComponentTypeInfo& info, bool& replaced);
+    // componentIndex is ComponentIndex<T>()
+    void* GetComponentStorage(EntityID id, uint32_t componentIndex);
+    const void* ReadComponentStorage(EntityID id, uint32_t componentIndex) const;
+    uint32_t GetComponentVersion(EntityID id, uint32_t componentIndex) const;
+    void RemoveComponentStorage(EntityID id, uint32_t componentIndex);
+
+    const QueryCache* GetQueryCache(std::initializer_list<uint32_t> components);
+};
+
+// Per-consumer window for View::Changed / View::Added:
+//
+//     uint32_t since = cursor.Begin(entityManager);
+//     for (auto [t] : entityManager.GetView<const Transform>().Changed<Transform>(since)) { ... }
+//
+// Each Begin() yields everything written since the previous Begin().
+struct ChangeCursor {
+    uint32_t seen{0};
+
+    uint32_t Begin(EntityManager& entityManager) {
+        uint32_t since = seen;
+        seen = entityManager.AdvanceChangeVersion();
+        return since;
+    }
 };
 
+// ============================================================================
+// Entity Template Implementation
+// ============================================================================
+
+template<typename T, typename... Args>
+T& Entity::AddComponent(Args&&... args) {
+    return manager->AddComponent<T>(id, std::forward<Args>(args)...);
+}
+
+template<typename T>
+T* Entity::GetComponent() {
+    return manager ? manager->GetComponent<T>(id) : nullptr;
+}
+
+template<typename T>
+bool Entity::HasComponent() const {
+    return manager && manager->HasComponent<T>(id);
+}
+
+template<typename T>
+void Entity::RemoveComponent() {
+    if (manager) manager->RemoveComponent<T>(id);
+}
+
 // ============================================================================
 // Event System
 // ============================================================================
 
+class IEventChannel {
+public:
+    virtual ~IEventChannel() = default;
+    virtual void Dispatch() = 0;
+    virtual void Clear() = 0;
+};
+
+// Queue of events of one type, stored by value and delivered in batches when
+// the bus is dispatched. Publish() appends to a double-buffered frame queue
+// and is meant for the thread that dispatches (the main thread, outside the
+// parallel system update). PublishAsync() is lock-free and may be called from
+// any thread; it goes through a bounded MPSC ring and fails when the ring is
+// full. Neither allocates once the queues have reached their working size.
+template<typename E>
+class EventChannel : public IEventChannel {
+private:
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        alignas(E) unsigned char storage[sizeof(E)];
+    };
+
+    std::vector<E> queued;       // published this frame
+    std::vector<E> dispatching;  // being delivered; swapped with queued
+    std::vector<std::function<void(const E&)>> subscribers;
+
+    // Bounded MPSC ring (Vyukov); producers claim slots with a CAS on
+    // enqueuePos and publish them by bumping the slot sequence
+    std::unique_ptr<Slot[]> ring;
+    size_t ringMask{0};
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos{0};
+    std::atomic<uint64_t> dropped{0};
+
+public:
+    // asyncCapacity is rounded up to a power of two
+    explicit EventChannel(size_t asyncCapacity = 1024) {
+        size_t capacity = 2;
+        while (capacity < asyncCapacity) capacity <<= 1;
+        ring.reset(new Slot[capacity]);
+        ringMask = capacity - 1;
+        for (size_t i = 0; i < capacity; ++i) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~EventChannel() override {
+        // Async events still in the ring own resources
+        DrainAsync(queued);
+    }
+
+    void Subscribe(std::function<void(const E&)> callback) {
+        subscribers.push_back(std::move(callback));
+    }
+
+    void Publish(const E& event) {
+        queued.push_back(event);
+    }
+
+    bool PublishAsync(const E& event) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = ring[pos & ringMask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    new (slot.storage) E(event);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Delivers everything published so far, async events after frame events.
+    // Events published by handlers are delivered on the next dispatch.
+    void Dispatch() override {
+        DrainAsync(queued);
+        std::swap(queued, dispatching);
+        for (const E& event : dispatching) {
+            for (auto& callback : subscribers) {
+                callback(event);
+            }
+        }
+        dispatching.clear();
+    }
+
+    // Drops pending events and subscribers
+    void Clear() override {
+        DrainAsync(queued);
+        queued.clear();
+        dispatching.clear();
+        subscribers.clear();
+    }
+
+    size_t GetPendingCount() const { return queued.size(); }
+    uint64_t GetDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    // Single consumer: only called from Dispatch/Clear
+    void DrainAsync(std::vector<E>& out) {
+        while (true) {
+            Slot& slot = ring[dequeuePos & ringMask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != dequeuePos + 1) return;
+
+            E* event = reinterpret_cast<E*>(slot.storage);
+            out.push_back(std::move(*event));
+            event->~E();
+            slot.sequence.store(dequeuePos + ringMask + 1, std::memory_order_release);
+            ++dequeuePos;
+        }
+    }
+};
+
 class EventBus {
 private:
     std::unordered_map<EventID, std::vector<std::function<void(const Event&)>>> subscribers;
 
+    // Typed channels, keyed by event type; order kept for deterministic dispatch
+    std::unordered_map<std::type_index, IEventChannel*> channelLookup;
+    std::vector<std::unique_ptr<IEventChannel>> channels;
+    std::mutex channelMutex;
+
 public:
+    // Immediate dispatch by runtime EventID
     void Subscribe(EventID eventType, std::function<void(const Event&)> callback);
     void Publish(const Event& event);
+
+    // Typed, queued channel for E, created on first use. Cache the reference
+    // on hot paths; the lookup takes a lock.
+    template<typename E>
+    EventChannel<E>& Channel() {
+        std::lock_guard<std::mutex> lock(channelMutex);
+        IEventChannel*& channel = channelLookup[std::type_index(typeid(E))];
+        if (!channel) {
+            channels.push_back(std::make_unique<EventChannel<E>>());
+            channel = channels.back().get();
+        }
+        return *static_cast<EventChannel<E>*>(channel);
+    }
+
+    // Delivers queued events on every channel, in channel creation order
+    void Dispatch();
     void Clear();
 };
 
@@ -226,8 +1218,18 @@ struct EngineConfig {
     uint32_t windowWidth{1280};
     uint32_t windowHeight{720};
     uint32_t targetFPS{60};
+    // Fixed simulation ticks per second, so simulation keeps to real time on a
+    // loaded server; RenderFrame blends the last two ticks. 0 = one variable
+    // step of the whole frame time per frame.
+    uint32_t tickRate{60};
+    uint32_t maxTicksPerFrame{5};   // Further ticks owed after a hitch are dropped
     bool vsync{true};
     bool headless{false};  // Useful for dedicated servers or batch processing
+    int workerThreads{-1};  // Job system workers: -1 = auto, 0 = main thread only
+    std::string telemetryName;  // Publish frame stats to shared memory under this name; empty = off
+    // Trace frames slower than this multiple of the rolling p95; 0 = off. The
+    // profiler is process-wide: only while no other engine is updating
+    float hitchRatio{0.0f};
 };
 
 } // namespace Titan
@@ -69,6 +69,7 @@ public:
     void Initialize() override;
     void Update(float deltaTime) override;
     void Shutdown() override;
+    const char* GetName() const override { return "Decals"; }
 
     void SpawnDecal(const glm::vec3& pos, const glm::vec3& normal, 
                     const std::string& texture, float lifetime = 5.0f);
@@ -108,6 +109,9 @@ public:
     ComponentID GetComponentID() const override { return StaticID(); }
 };
 
+template<> struct IsPlainComponent<LightComponent>
+    : PlainComponentMembers<decltype(LightComponent::light), decltype(LightComponent::castShadows)> {};
+
 // ============================================================================
 // Advanced Renderer with Effects
 // ============================================================================
@@ -10,6 +10,13 @@
 #include "Physics.hpp"
 #include "Renderer.hpp"
 #include "Window.hpp"
+#include "Jobs.hpp"
+#include "Memory.hpp"
+#include "Scheduler.hpp"
+#include "Hierarchy.hpp"
+#include "Timing.hpp"
+#include "Snapshot.hpp"
+#include "Telemetry.hpp"
 #include "TitanExports.hpp"
 #include <memory>
 #include <vector>
@@ -31,11 +38,18 @@ class TITAN_API Engine {
 private:
     EngineConfig config;
     bool running{false};
-    float deltaTime{0.0f};
+    float deltaTime{0.0f};     // Step of the current simulation update
+    float frameTime{0.0f};     // Real time of the last frame
     float elapsedTime{0.0f};
+    FixedTimestep fixedTimestep;
+    FramePacer framePacer;
     
     // Core systems
+    std::unique_ptr<JobSystem> jobSystem;
+    std::unique_ptr<LinearArena> frameArena;
     std::unique_ptr<EntityManager> entityManager;
+    std::unique_ptr<TransformHierarchy> transformHierarchy;
+    std::unique_ptr<TransformInterpolator> transformInterpolator;
     std::unique_ptr<EventBus> eventBus;
     std::unique_ptr<Window> window;
     std::unique_ptr<Renderer> renderer;
@@ -46,16 +60,22 @@ private:
 
     // Systems list for update
     std::vector<ISystem*> systems;
+    std::unique_ptr<SystemScheduler> scheduler;
 
     // Advanced systems
     std::unique_ptr<NetworkManager> networkManager;
     std::unique_ptr<Gamemode> gamemode;
     std::unique_ptr<CullingSystem> cullingSystem;
     std::unique_ptr<PerformanceMonitor> performanceMonitor;
+    std::unique_ptr<TelemetryPublisher> telemetry;  // only with config.telemetryName
+    std::unique_ptr<HitchRecorder> hitchRecorder;   // only with config.hitchRatio
 
     // Timing
     double lastFrameTime{0.0};
 
+    // Allocation counters at the end of the last frame (stay zero without hooks)
+    AllocationSnapshot allocationTotals;
+
 public:
     Engine() = default;
     ~Engine();
@@ -68,13 +88,25 @@ public:
     void Run();
     void Stop() { running = false; }
 
-    // Frame timing
+    // Frame timing. With a fixed tick rate, GetDeltaTime() is the tick length
+    // and the simulation runs 0..maxTicksPerFrame ticks per rendered frame.
     float GetDeltaTime() const { return deltaTime; }
+    float GetFrameTime() const { return frameTime; }
     float GetElapsedTime() const { return elapsedTime; }
+    const FixedTimestep& GetFixedTimestep() const { return fixedTimestep; }
+    const FramePacer& GetFramePacer() const { return framePacer; }
+
+    // How far rendering is between the last two simulation ticks, in [0, 1)
+    float GetInterpolationAlpha() const { return config.tickRate > 0 ? fixedTimestep.GetAlpha() : 1.0f; }
 
     // System access
     EntityManager& GetEntityManager() { return *entityManager; }
+    JobSystem& GetJobSystem();
+    // Scratch memory released at the start of the next frame; main thread only
+    LinearArena& GetFrameArena();
     EventBus& GetEventBus() { return *eventBus; }
+    // World matrices are refreshed at the end of each UpdateSystems
+    TransformHierarchy& GetTransformHierarchy();
     Renderer& GetRenderer();
     InputSystem& GetInputSystem();
     ScriptingSystem& GetScriptingSystem();
@@ -84,11 +116,19 @@ public:
     Gamemode& GetGamemode();
     PerformanceMonitor& GetPerformanceMonitor();
 
+    // Simulation state (world and gamemode) for rollback; call between frames
+    void CaptureSnapshot(WorldSnapshot& snapshot);
+    void RestoreSnapshot(WorldSnapshot& snapshot);
+
     // Configuration
     const EngineConfig& GetConfig() const { return config; }
 
     // Public methods for C API
-    void UpdateSystemsPublic(float dt) { UpdateSystems(dt); }
+    // One host frame: releases the frame arena, then runs one update
+    void UpdateSystemsPublic(float dt) {
+        ReleaseFrameScratch();
+        UpdateSystems(dt);
+    }
     void RenderFramePublic() { RenderFrame(); }
 
     // Initialization check
@@ -97,15 +137,9 @@ public:
 private:
     void InitializeSystems();
     void UpdateSystems(float dt);
+    void ReleaseFrameScratch();
     void RenderFrame();
     void CalculateDeltaTime();
 };
 
-// ============================================================================
-// Global Engine Instance
-// ============================================================================
-
-Engine& GetEngine();
-void SetEngineInstance(Engine* engine);
-
 } // namespace Titan
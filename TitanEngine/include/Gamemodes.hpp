@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core.hpp"
+#include "Snapshot.hpp"
 #include <memory>
 #include <vector>
 
@@ -30,11 +31,39 @@ struct Team {
     int32_t score{0};
 };
 
+// ============================================================================
+// Gameplay Events
+// ============================================================================
+
+struct PlayerDeathEvent : public Event {
+    uint32_t playerID{0};
+    uint32_t killerID{0};
+
+    PlayerDeathEvent(uint32_t player, uint32_t killer) : Event(2001), playerID(player), killerID(killer) {}
+};
+
+struct RoundEndedEvent : public Event {
+    GamemodeType gamemode;
+    int32_t winningTeam{-1};  // -1 = draw or no teams
+
+    RoundEndedEvent(GamemodeType type, int32_t winner) : Event(2002), gamemode(type), winningTeam(winner) {}
+};
+
 // ============================================================================
 // Gamemode Interface
 // ============================================================================
 
 class Gamemode : public ISystem {
+protected:
+    // Resolved once in SetEventBus; EventBus::Channel takes a lock
+    EventChannel<PlayerDeathEvent>* playerDeathChannel{nullptr};
+    EventChannel<RoundEndedEvent>* roundEndedChannel{nullptr};
+    EntityManager* world{nullptr};
+
+    // Gamemodes may run on a worker thread, so these use the lock-free path
+    void PublishPlayerDeath(uint32_t playerID, uint32_t killerID);
+    void PublishRoundEnded();
+
 public:
     virtual ~Gamemode() = default;
 
@@ -42,6 +71,12 @@ public:
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    const char* GetName() const override { return "Gamemode"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.WriteResource("Gamemode");
+    }
+
     // Gamemode lifecycle
     virtual void StartRound() = 0;
     virtual void EndRound() = 0;
@@ -56,6 +91,16 @@ public:
     virtual float GetRoundTimeRemaining() const = 0;
     virtual const std::vector<Team>& GetTeams() const = 0;
     virtual int32_t GetWinningTeam() const = 0;
+
+    // Round and score state for Engine::CaptureSnapshot / RestoreSnapshot
+    virtual void SaveState(std::vector<uint8_t>& out) const = 0;
+    virtual void LoadState(const std::vector<uint8_t>& in) = 0;
+
+    void SetEventBus(EventBus* bus) {
+        playerDeathChannel = bus ? &bus->Channel<PlayerDeathEvent>() : nullptr;
+        roundEndedChannel = bus ? &bus->Channel<RoundEndedEvent>() : nullptr;
+    }
+    void SetWorld(EntityManager* entityManager) { world = entityManager; }
 };
 
 // ============================================================================
@@ -87,6 +132,9 @@ public:
     float GetRoundTimeRemaining() const override { return maxRoundTime - roundTime; }
     const std::vector<Team>& GetTeams() const override;
     int32_t GetWinningTeam() const override { return -1; }
+
+    void SaveState(std::vector<uint8_t>& out) const override;
+    void LoadState(const std::vector<uint8_t>& in) override;
 };
 
 // ============================================================================
@@ -120,6 +168,9 @@ public:
     float GetRoundTimeRemaining() const override { return maxRoundTime - roundTime; }
     const std::vector<Team>& GetTeams() const override { return teams; }
     int32_t GetWinningTeam() const override;
+
+    void SaveState(std::vector<uint8_t>& out) const override;
+    void LoadState(const std::vector<uint8_t>& in) override;
 };
 
 // ============================================================================
@@ -144,9 +195,15 @@ private:
     int32_t teamBCTWins{0};
     int32_t maxWins{16};
 
+    WorldSnapshot roundStart;  // see SaveRoundStart
+
 public:
     BombDefusalGamemode();
 
+    // Captures the world every round starts from (spawned players, map
+    // props); StartRound then resets the world by restoring it
+    void SaveRoundStart();
+
     void Initialize() override;
     void Update(float deltaTime) override;
     void Shutdown() override;
@@ -169,6 +226,9 @@ public:
     float GetRoundTimeRemaining() const override { return maxRoundTime - roundTime; }
     const std::vector<Team>& GetTeams() const override { return teams; }
     int32_t GetWinningTeam() const override;
+
+    void SaveState(std::vector<uint8_t>& out) const override;
+    void LoadState(const std::vector<uint8_t>& in) override;
 };
 
 } // namespace Titan
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Titan {
+
+// ============================================================================
+// Hardware Counters
+// ============================================================================
+
+enum class HardwareCounter : uint32_t {
+    Cycles,
+    Instructions,
+    L1DataMisses,   // L1 data cache read misses
+    LLCMisses,      // last level cache misses
+    BranchMisses,
+    Count
+};
+
+static constexpr size_t HARDWARE_COUNTER_COUNT = static_cast<size_t>(HardwareCounter::Count);
+
+// Counter values for one thread; only counters with their validMask bit set
+// were measured. Differences of two reads give the counts in between.
+struct CounterSample {
+    uint64_t values[HARDWARE_COUNTER_COUNT]{};
+    uint32_t validMask{0};
+
+    bool Has(HardwareCounter counter) const { return (validMask >> static_cast<uint32_t>(counter)) & 1u; }
+    uint64_t Get(HardwareCounter counter) const { return values[static_cast<size_t>(counter)]; }
+    bool Empty() const { return validMask == 0; }
+
+    // Instructions per cycle, 0 unless both were measured
+    double GetIPC() const {
+        if (!Has(HardwareCounter::Cycles) || !Has(HardwareCounter::Instructions) || Get(HardwareCounter::Cycles) == 0) return 0.0;
+        return static_cast<double>(Get(HardwareCounter::Instructions)) / Get(HardwareCounter::Cycles);
+    }
+
+    // Counts from start to this sample; valid where both are
+    CounterSample Since(const CounterSample& start) const {
+        CounterSample result;
+        result.validMask = validMask & start.validMask;
+        for (size_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) {
+            // Multiplexed counters are scaled estimates and may step back slightly
+            if ((result.validMask >> i) & 1u) result.values[i] = values[i] > start.values[i] ? values[i] - start.values[i] : 0;
+        }
+        return result;
+    }
+
+    // Sums counts; an empty sample adopts the other's valid counters
+    CounterSample& operator+=(const CounterSample& other) {
+        if (other.Empty()) return *this;
+        validMask = Empty() ? other.validMask : validMask & other.validMask;
+        for (size_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) values[i] += other.values[i];
+        return *this;
+    }
+};
+
+// Per-thread CPU performance counters through Linux perf_event_open, counting
+// user-space events of the calling thread only. Each thread opens its
+// counters on its first Read while enabled and keeps them until it exits.
+// Counters the CPU, kernel or perf_event_paranoid setting refuse are left out
+// of validMask; on other platforms nothing is ever valid. Reading costs one
+// system call, so leave the counters off unless investigating.
+class TITAN_API HardwareCounters {
+public:
+    static void SetEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // Reads the calling thread's counters; false when disabled or when no
+    // counter could be opened
+    static bool Read(CounterSample& out);
+
+    // Counters the calling thread can measure (opens them if needed)
+    static uint32_t GetAvailableMask();
+    // Why counters are missing on the calling thread, empty if all are there
+    static std::string GetStatus();
+
+    static const char* GetName(HardwareCounter counter);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+} // namespace Titan
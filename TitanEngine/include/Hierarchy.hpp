@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Core.hpp"
+#include "TitanExports.hpp"
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Titan {
+
+// ============================================================================
+// Transform Hierarchy
+// ============================================================================
+
+// Parent/child relationships between entities and their cached world
+// matrices. A child's Transform is relative to its parent.
+//
+// Nodes (every entity that is a parent or has one) are stored as parallel
+// arrays sorted by depth, so one forward pass sees every parent before its
+// children. Update() only recomputes nodes whose Transform changed since the
+// previous Update (see ChangeCursor) and their descendants; if nothing moved
+// it does no matrix work at all.
+//
+// Relationship changes take effect on the next Update(). Destroyed entities
+// are dropped there too; their children become roots.
+class TITAN_API TransformHierarchy {
+private:
+    static constexpr int32_t NO_PARENT = -1;
+
+    // Source of truth: child -> parent
+    std::unordered_map<EntityID, EntityID> parentOf;
+
+    // Depth-sorted nodes, rebuilt when relationships change
+    std::vector<EntityID> entities;
+    std::vector<int32_t> parents;          // Node index, or NO_PARENT
+    std::vector<glm::mat4> worldMatrices;
+    std::vector<uint8_t> dirty;
+    std::unordered_map<EntityID, uint32_t> nodeLookup;
+    bool orderDirty{false};
+
+    ChangeCursor cursor;
+    size_t lastUpdateCount{0};
+
+public:
+    // Throws if the link would create a cycle
+    void SetParent(EntityID child, EntityID parent);
+    void ClearParent(EntityID child);
+    EntityID GetParent(EntityID child) const;
+    size_t GetNodeCount() const { return entities.size(); }
+
+    // Brings world matrices up to date; call once per frame after the
+    // systems that move entities have run
+    void Update(EntityManager& entityManager);
+
+    // World matrix as of the last Update. Entities outside the hierarchy use
+    // their own Transform.
+    glm::mat4 GetWorldMatrix(const EntityManager& entityManager, EntityID id) const;
+
+    // Nodes recomputed by the last Update
+    size_t GetLastUpdateCount() const { return lastUpdateCount; }
+
+    void Clear();
+
+private:
+    void Rebuild(EntityManager& entityManager);
+};
+
+// ============================================================================
+// Transform Interpolation
+// ============================================================================
+
+// Transforms as of the previous simulation tick, so rendering can blend the
+// last two ticks with a fixed tick rate (Engine::GetInterpolationAlpha).
+//
+// BeginTick() runs before each tick and stores the transforms that are about
+// to be simulated. It only copies chunks written since the previous BeginTick
+// (see ChangeCursor); an entity that did not move keeps its stored transform,
+// which is then equal to its current one.
+class TITAN_API TransformInterpolator {
+private:
+    std::unordered_map<EntityID, Transform> previous;
+    ChangeCursor cursor;
+
+public:
+    void BeginTick(EntityManager& entityManager);
+
+    // current blended from its previous-tick value by alpha; entities not seen
+    // by a BeginTick yet are drawn where they are
+    Transform Blend(EntityID id, const Transform& current, float alpha) const;
+
+    size_t GetTrackedCount() const { return previous.size(); }
+    void Clear();
+};
+
+} // namespace Titan
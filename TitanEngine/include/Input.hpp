@@ -94,6 +94,15 @@ struct MouseScrollEvent : public Event {
 // ============================================================================
 
 class InputSystem : public ISystem {
+protected:
+    // Resolved once in SetEventBus; EventBus::Channel takes a lock
+    EventChannel<KeyPressedEvent>* keyPressedChannel{nullptr};
+    EventChannel<KeyReleasedEvent>* keyReleasedChannel{nullptr};
+    EventChannel<MouseMovedEvent>* mouseMovedChannel{nullptr};
+    EventChannel<MouseButtonPressedEvent>* mouseButtonPressedChannel{nullptr};
+    EventChannel<MouseButtonReleasedEvent>* mouseButtonReleasedChannel{nullptr};
+    EventChannel<MouseScrollEvent>* mouseScrollChannel{nullptr};
+
 public:
     virtual ~InputSystem() = default;
 
@@ -101,6 +110,12 @@ public:
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    const char* GetName() const override { return "Input"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.WriteResource("Input");
+    }
+
     virtual bool IsKeyPressed(KeyCode key) const = 0;
     virtual bool IsKeyReleased(KeyCode key) const = 0;
     virtual bool IsMouseButtonPressed(MouseButton button) const = 0;
@@ -111,6 +126,16 @@ public:
 
     virtual void SetInputLocked(bool locked) = 0;
     virtual bool IsInputLocked() const = 0;
+
+    // Input events are queued on the bus's typed channels when set
+    void SetEventBus(EventBus* bus) {
+        keyPressedChannel = bus ? &bus->Channel<KeyPressedEvent>() : nullptr;
+        keyReleasedChannel = bus ? &bus->Channel<KeyReleasedEvent>() : nullptr;
+        mouseMovedChannel = bus ? &bus->Channel<MouseMovedEvent>() : nullptr;
+        mouseButtonPressedChannel = bus ? &bus->Channel<MouseButtonPressedEvent>() : nullptr;
+        mouseButtonReleasedChannel = bus ? &bus->Channel<MouseButtonReleasedEvent>() : nullptr;
+        mouseScrollChannel = bus ? &bus->Channel<MouseScrollEvent>() : nullptr;
+    }
 };
 
 // ============================================================================
@@ -148,7 +173,8 @@ public:
     void SetInputLocked(bool locked) override { inputLocked = locked; }
     bool IsInputLocked() const override { return inputLocked; }
 
-    // Internal methods for platform-specific input handling
+    // Internal methods for platform-specific input handling. Called from the
+    // window's message pump on the main thread.
     void OnKeyPressed(KeyCode key);
     void OnKeyReleased(KeyCode key);
     void OnMouseMoved(float x, float y);
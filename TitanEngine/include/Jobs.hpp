@@ -0,0 +1,117 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Titan {
+
+// ============================================================================
+// Jobs
+// ============================================================================
+
+class JobCounter;
+
+using JobFunction = std::function<void()>;
+
+struct Job {
+    JobFunction function;
+    JobCounter* counter{nullptr};  // decremented when the job finishes
+};
+
+// Counts outstanding jobs. Wait on it with JobSystem::Wait, or chain work
+// behind it with JobSystem::RunAfter. Must outlive the jobs that reference it.
+class TITAN_API JobCounter {
+private:
+    friend class JobSystem;
+
+    std::atomic<int> value{0};
+    std::mutex mutex;                 // guards continuations and error
+    std::vector<Job> continuations;   // released when value reaches zero
+    std::exception_ptr error;         // first exception thrown by a counted job
+
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return value.load(std::memory_order_acquire) == 0; }
+    int GetValue() const { return value.load(std::memory_order_acquire); }
+};
+
+// ============================================================================
+// Job System
+// ============================================================================
+
+// Work-stealing thread pool. Every worker owns a deque: it pushes and pops at
+// the back (LIFO, cache-warm) while idle workers steal from the front of
+// other deques. Threads that are not workers (the main thread) share queue 0
+// and execute jobs while they wait, so a job system with zero workers still
+// runs everything, just on the calling thread.
+class TITAN_API JobSystem {
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // [0] = non-worker threads
+    std::vector<std::thread> workers;
+
+    std::atomic<size_t> queuedJobs{0};
+    std::atomic<uint32_t> sleepingWorkers{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    std::atomic<uint64_t> executedJobs{0};
+    std::atomic<uint64_t> stolenJobs{0};
+
+public:
+    // workerCount < 0 picks hardware_concurrency - 1
+    explicit JobSystem(int workerCount = -1);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Queues a job; counter (optional) is incremented now and decremented when it finishes
+    void Run(JobFunction function, JobCounter* counter = nullptr);
+
+    // Queues a job once dependency reaches zero
+    void RunAfter(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+    // Executes queued jobs until counter reaches zero, then rethrows the first
+    // exception any of its jobs threw
+    void Wait(JobCounter& counter);
+
+    // Splits [0, count) into batches of at least minBatchSize and calls
+    // body(begin, end) for each, returning once all batches have run
+    void ParallelFor(size_t count, const std::function<void(size_t, size_t)>& body, size_t minBatchSize = 1);
+
+    // Executes one queued job on the calling thread; false if none was found
+    bool RunPendingJob();
+
+    size_t GetWorkerCount() const { return workers.size(); }
+    size_t GetThreadCount() const { return workers.size() + 1; }
+    uint64_t GetExecutedJobCount() const { return executedJobs.load(std::memory_order_relaxed); }
+    uint64_t GetStolenJobCount() const { return stolenJobs.load(std::memory_order_relaxed); }
+
+private:
+    void WorkerLoop(uint32_t queueIndex);
+    void Push(Job job);
+    bool Pop(uint32_t queueIndex, Job& job);
+    void Execute(Job& job);
+    void Finish(JobCounter& counter);
+    uint32_t CurrentQueue() const;
+};
+
+} // namespace Titan
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace Titan {
+
+// ============================================================================
+// Span
+// ============================================================================
+
+// Non-owning view of a contiguous array (the arena-backed return type)
+template<typename T>
+struct Span {
+    T* data{nullptr};
+    size_t size{0};
+
+    T* begin() const { return data; }
+    T* end() const { return data + size; }
+    T& operator[](size_t index) const { return data[index]; }
+    size_t Size() const { return size; }
+    bool Empty() const { return size == 0; }
+};
+
+// ============================================================================
+// Linear Arena
+// ============================================================================
+
+// Bump allocator for transient data. Allocation is a pointer increment and
+// Reset() rewinds every allocation at once in O(1); destructors are never run,
+// so only trivially destructible types may be placed in it. Blocks added when
+// the first one overflows are kept and reused after Reset. Not thread-safe:
+// use one arena per thread (see GetThreadScratchArena).
+class TITAN_API LinearArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    // Position to rewind to; see ArenaScope
+    struct Marker {
+        size_t block{0};
+        size_t offset{0};
+        size_t used{0};
+    };
+
+private:
+    struct Block {
+        uint8_t* data{nullptr};
+        size_t size{0};
+    };
+
+    std::vector<Block> blocks;
+    size_t blockSize;
+    size_t currentBlock{0};
+    size_t offset{0};      // into blocks[currentBlock]
+    size_t usedBytes{0};   // requested since the last Reset, including padding
+    size_t peakBytes{0};   // highest usedBytes since the last ResetPeak
+
+public:
+    explicit LinearArena(size_t defaultBlockSize = DEFAULT_BLOCK_SIZE);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Uninitialised storage for count objects of T
+    template<typename T>
+    Span<T> AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without running destructors");
+        if (count == 0) return Span<T>{};
+        return Span<T>{ static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))), count };
+    }
+
+    void Reset();
+    Marker GetMarker() const { return Marker{ currentBlock, offset, usedBytes }; }
+    void Rewind(const Marker& marker);
+
+    size_t GetUsedBytes() const { return usedBytes; }
+    size_t GetPeakBytes() const { return peakBytes; }
+    void ResetPeak() { peakBytes = usedBytes; }
+    size_t GetCapacity() const;
+};
+
+// Rewinds an arena to where it was when the scope was entered
+class ArenaScope {
+private:
+    LinearArena& arena;
+    LinearArena::Marker marker;
+
+public:
+    explicit ArenaScope(LinearArena& scopeArena) : arena(scopeArena), marker(scopeArena.GetMarker()) {}
+    ~ArenaScope() { arena.Rewind(marker); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+};
+
+// Per-thread scratch arena for job workers and other code off the main
+// thread. It is never reset globally; wrap each use in an ArenaScope.
+TITAN_API LinearArena& GetThreadScratchArena();
+
+// ============================================================================
+// Allocation Tracking
+// ============================================================================
+
+// A memory tag names who allocates: a subsystem, a system (the scheduler
+// tags each system's update with its GetName) or any other scope. Tag 0 is
+// "Untagged"; once MAX_MEMORY_TAGS are registered, further names share the
+// last tag.
+using MemoryTag = uint32_t;
+static constexpr MemoryTag UNTAGGED_MEMORY = 0;
+static constexpr size_t MAX_MEMORY_TAGS = 64;
+static constexpr size_t MAX_TRACKED_THREADS = 64;
+
+// Same name, same tag; the name must stay valid (use a string literal)
+TITAN_API MemoryTag RegisterMemoryTag(const char* name);
+TITAN_API const char* GetMemoryTagName(MemoryTag tag);
+
+// Attributes this thread's allocations to a tag until the scope ends
+class TITAN_API MemoryTagScope {
+private:
+    MemoryTag previous;
+
+public:
+    explicit MemoryTagScope(MemoryTag tag);
+    explicit MemoryTagScope(const char* name) : MemoryTagScope(RegisterMemoryTag(name)) {}
+    ~MemoryTagScope();
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+};
+
+struct AllocationCounters {
+    uint64_t allocations{0};
+    uint64_t frees{0};
+    uint64_t allocatedBytes{0};
+    uint64_t freedBytes{0};
+
+    int64_t GetLiveBytes() const { return static_cast<int64_t>(allocatedBytes - freedBytes); }
+};
+
+// Counters of every tag and thread slot at one point in time. Fixed size,
+// so taking one never allocates.
+struct AllocationSnapshot {
+    AllocationCounters tags[MAX_MEMORY_TAGS];
+    AllocationCounters threads[MAX_TRACKED_THREADS];  // slot 0: exited threads and overflow
+    AllocationCounters total;
+
+    // What happened between previous and this snapshot
+    AllocationSnapshot Since(const AllocationSnapshot& previous) const;
+};
+
+// Counts allocations made through Allocate/Free: by the global operator
+// new/delete once AllocationHooks.hpp is compiled into the executable, and
+// by TaggedAllocator. Each thread counts into its own slot without locks;
+// snapshots read all slots and are consistent to within in-flight updates.
+//
+// Call sites are named after the innermost profiler zone when the profiler
+// is recording, or else after the memory tag.
+class TITAN_API MemoryTracker {
+public:
+    struct CallSite {
+        const char* name{nullptr};
+        uint64_t allocations{0};
+        uint64_t bytes{0};
+    };
+
+    // Null on failure. Every block carries a small header with its size and tag.
+    static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    static void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+    // Accepts null; the block must come from Allocate
+    static void Free(void* pointer);
+
+    static MemoryTag GetCurrentTag();
+    // Slot this thread counts into (0 after it ran out of slots)
+    static uint32_t GetThreadSlot();
+
+    static void TakeSnapshot(AllocationSnapshot& out);
+    // Since process start, by allocation count
+    static std::vector<CallSite> GetTopCallSites(size_t count);
+    static void PrintReport(std::ostream& out, size_t topSites = 10);
+};
+
+// STL allocator that tracks under a fixed tag, with or without global hooks
+template<typename T>
+class TaggedAllocator {
+public:
+    using value_type = T;
+
+    MemoryTag tag{UNTAGGED_MEMORY};
+
+    TaggedAllocator() = default;
+    explicit TaggedAllocator(MemoryTag memoryTag) : tag(memoryTag) {}
+    template<typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other) : tag(other.tag) {}
+
+    T* allocate(size_t count) {
+        constexpr size_t alignment = alignof(T) > alignof(std::max_align_t) ? alignof(T) : alignof(std::max_align_t);
+        void* memory = MemoryTracker::Allocate(sizeof(T) * count, alignment, tag);
+        if (!memory) throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* pointer, size_t) { MemoryTracker::Free(pointer); }
+
+    template<typename U>
+    bool operator==(const TaggedAllocator<U>& other) const { return tag == other.tag; }
+    template<typename U>
+    bool operator!=(const TaggedAllocator<U>& other) const { return tag != other.tag; }
+};
+
+} // namespace Titan
@@ -30,6 +30,14 @@ struct NetMessage {
     std::vector<uint8_t> data;
 };
 
+// Running totals since the manager was created
+struct NetworkStats {
+    uint64_t messagesSent{0};
+    uint64_t messagesReceived{0};
+    uint64_t bytesSent{0};
+    uint64_t bytesReceived{0};
+};
+
 enum class ConnectionState {
     Disconnected,
     Connecting,
@@ -67,6 +75,12 @@ public:
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    const char* GetName() const override { return "Network"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.WriteResource("Network");
+    }
+
     // Connection
     virtual bool StartServer(uint16_t port, uint32_t maxPlayers) = 0;
     virtual bool ConnectToServer(const std::string& serverIP, uint16_t port, const std::string& playerName) = 0;
@@ -76,6 +90,8 @@ public:
     virtual void SendMessage(const NetMessage& message, bool reliable = true) = 0;
     virtual void BroadcastMessage(const NetMessage& message, bool reliable = true) = 0;
     virtual std::vector<NetMessage> ReceiveMessages() = 0;
+    // Appends pending messages to out (reuse it across frames); returns how many
+    virtual size_t ReceiveMessages(std::vector<NetMessage>& out) = 0;
 
     // Player Management
     virtual const std::unordered_map<uint32_t, std::shared_ptr<NetworkPlayer>>& GetConnectedPlayers() const = 0;
@@ -87,6 +103,11 @@ public:
     // Server only
     virtual void SpawnPlayer(uint32_t playerID, const glm::vec3& position) = 0;
     virtual void KillPlayer(uint32_t playerID, uint32_t killerID) = 0;
+
+    const NetworkStats& GetStats() const { return stats; }
+
+protected:
+    NetworkStats stats;  // implementations count what they send and receive
 };
 
 // ============================================================================
@@ -119,6 +140,7 @@ public:
     void SendMessage(const NetMessage& message, bool reliable = true) override;
     void BroadcastMessage(const NetMessage& message, bool reliable = true) override;
     std::vector<NetMessage> ReceiveMessages() override;
+    size_t ReceiveMessages(std::vector<NetMessage>& out) override;
 
     const std::unordered_map<uint32_t, std::shared_ptr<NetworkPlayer>>& GetConnectedPlayers() const override { return players; }
     std::shared_ptr<NetworkPlayer> GetPlayer(uint32_t playerID) override;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <functional>
@@ -26,6 +27,38 @@ struct Snapshot {
     uint8_t health;
 };
 
+// Snapshot broadcast packet: tick (uint32), count (uint32), then count
+// snapshots as raw structs. Portable, so it can be tested and benchmarked
+// without Winsock.
+inline size_t GetSnapshotPacketSize(uint32_t count) {
+    return 8 + count * sizeof(Snapshot);
+}
+
+// out must hold GetSnapshotPacketSize(count) bytes
+inline void WriteSnapshotPacket(uint32_t tick, const Snapshot* snapshots, uint32_t count, uint8_t* out) {
+    memcpy(out, &tick, 4);
+    memcpy(out + 4, &count, 4);
+    if (count > 0) memcpy(out + 8, snapshots, count * sizeof(Snapshot));
+}
+
+// Calls onSnapshot(const Snapshot&) for each snapshot; false if malformed
+template<typename Func>
+bool ReadSnapshotPacket(const uint8_t* data, size_t size, uint32_t& outTick, Func&& onSnapshot) {
+    if (size < 8) return false;
+    uint32_t count = 0;
+    memcpy(&outTick, data, 4);
+    memcpy(&count, data + 4, 4);
+    if (size != GetSnapshotPacketSize(count)) return false;
+    const uint8_t* ptr = data + 8;
+    for (uint32_t i = 0; i < count; ++i) {
+        Snapshot snapshot;
+        memcpy(&snapshot, ptr, sizeof(Snapshot));
+        ptr += sizeof(Snapshot);
+        onSnapshot(snapshot);
+    }
+    return true;
+}
+
 class IUDPTransport {
 public:
     virtual ~IUDPTransport() = default;
@@ -73,6 +106,9 @@ private:
     uint32_t tickCounter{0};
     std::chrono::steady_clock::time_point lastTick;
     std::vector<Snapshot> snapshotBuffer; // indexed by playerId
+    // Reused by every Update so polling does not allocate per packet
+    std::string receiveHost;
+    std::vector<uint8_t> receiveBuffer;
 };
 
 // Simple client that connects to a server and receives snapshots
@@ -95,6 +131,8 @@ private:
     std::string serverHost;
     uint16_t serverPort{0};
     uint32_t sequenceOut{0};
+    std::string receiveHost;
+    std::vector<uint8_t> receiveBuffer;
 };
 
 } // namespace Titan
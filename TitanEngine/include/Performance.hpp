@@ -1,8 +1,16 @@
 #pragma once
 
 #include "Core.hpp"
+#include "Memory.hpp"
+#include "HardwareCounters.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <vector>
+#include <ostream>
+#include <string>
+#include <thread>
 #include <unordered_set>
 
 namespace Titan {
@@ -36,6 +44,9 @@ struct Sphere {
 struct Frustum {
     glm::vec4 planes[6];  // Left, Right, Top, Bottom, Near, Far
 
+    // Normalized planes of a view-projection matrix (OpenGL clip space)
+    static Frustum FromViewProjection(const glm::mat4& viewProj);
+
     bool Contains(const glm::vec3& point) const;
     bool Contains(const Sphere& sphere) const;
     bool Contains(const AABB& aabb) const;
@@ -67,6 +78,13 @@ public:
     std::vector<EntityID> QuerySphere(const glm::vec3& center, float radius) const;
     std::vector<EntityID> QueryAABB(const AABB& aabb) const;
 
+    // Allocation-free variants: results replace the contents of a reused
+    // vector, or are placed in an arena (valid until the arena is reset)
+    void QuerySphere(const glm::vec3& center, float radius, std::vector<EntityID>& out) const;
+    void QueryAABB(const AABB& aabb, std::vector<EntityID>& out) const;
+    Span<EntityID> QuerySphere(const glm::vec3& center, float radius, LinearArena& arena) const;
+    Span<EntityID> QueryAABB(const AABB& aabb, LinearArena& arena) const;
+
     void Clear();
 };
 
@@ -84,6 +102,8 @@ public:
     void Initialize() override;
     void Update(float deltaTime) override;
     void Shutdown() override;
+    const char* GetName() const override { return "Culling"; }
+    void DeclareAccess(SystemAccess& access) const override;
 
     void UpdateViewFrustum(const glm::mat4& viewProj);
     void RegisterEntity(EntityID id);
@@ -138,39 +158,305 @@ public:
 };
 
 // ============================================================================
-// Performance Monitor
+// Ring Buffer
+// ============================================================================
+
+// Fixed-capacity FIFO; once full, each Push overwrites the oldest element.
+// Index 0 is the oldest element still held.
+template<typename T>
+class RingBuffer {
+private:
+    std::vector<T> items;
+    size_t head{0};  // next write position
+    size_t count{0};
+
+public:
+    explicit RingBuffer(size_t capacity) : items(std::max<size_t>(1, capacity)) {}
+
+    void Push(const T& item) {
+        items[head] = item;
+        head = (head + 1) % items.size();
+        count = std::min(count + 1, items.size());
+    }
+
+    T& operator[](size_t index) { return items[(head + items.size() - count + index) % items.size()]; }
+    const T& operator[](size_t index) const { return items[(head + items.size() - count + index) % items.size()]; }
+    T& Back() { return (*this)[count - 1]; }
+    const T& Back() const { return (*this)[count - 1]; }
+
+    size_t Size() const { return count; }
+    size_t Capacity() const { return items.size(); }
+    bool Empty() const { return count == 0; }
+    void Clear() {
+        head = 0;
+        count = 0;
+    }
+};
+
 // ============================================================================
+// Histogram
+// ============================================================================
+
+// HDR-style histogram of non-negative integer values: exact below 32, then
+// 32 linear sub-buckets per power of two, so percentiles are within ~3% of
+// the true value at any magnitude. Recording is O(1) and never allocates.
+class TITAN_API Histogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 5;
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
 
-class PerformanceMonitor {
 private:
+    std::vector<uint64_t> buckets;
+    uint64_t count{0};
+    uint64_t min{0};
+    uint64_t max{0};
+    double sum{0.0};
+
+public:
+    Histogram() : buckets(BUCKET_COUNT, 0) {}
+
+    void Record(uint64_t value);
+    void Merge(const Histogram& other);
+    void Reset();
+
+    // Smallest recorded bucket bound at or above percentile (0-100) of values
+    uint64_t Percentile(double percentile) const;
+    uint64_t GetCount() const { return count; }
+    uint64_t GetMin() const { return min; }
+    uint64_t GetMax() const { return max; }
+    double GetMean() const { return count ? sum / count : 0.0; }
+
+    static size_t BucketIndex(uint64_t value);
+    static uint64_t BucketUpperBound(size_t index);
+};
+
+// ============================================================================
+// Performance Monitor
+// ============================================================================
+
+// Keeps the last maxHistory frames in a ring buffer, plus a lifetime
+// histogram per metric. Window statistics are exact over the frames still
+// held; lifetime statistics cover every frame since Reset. Main thread only.
+class TITAN_API PerformanceMonitor {
+public:
     struct FrameStats {
-        float deltaTime{0.0f};
+        float deltaTime{0.0f};    // frame interval
+        float workTime{0.0f};     // StartFrame to EndFrame
         float renderTime{0.0f};
         float physicsTime{0.0f};
         float scriptTime{0.0f};
         uint32_t entityCount{0};
         uint32_t renderedEntities{0};
+        size_t scratchBytes{0};
+        uint32_t allocations{0};  // heap allocations, with AllocationHooks
+        size_t allocatedBytes{0};
+        CounterSample counters;   // summed over the frame's system updates
+    };
+
+    enum class Metric {
+        FrameTime,
+        WorkTime,
+        RenderTime,
+        PhysicsTime,
+        ScriptTime,
+        EntityCount,
+        RenderedEntities,
+        ScratchBytes,
+        Allocations,
+        AllocatedBytes,
+        // Hardware counters; frames without them are left out of the stats
+        Cycles,
+        Instructions,
+        L1DataMisses,
+        LLCMisses,
+        BranchMisses,
+        Count
     };
 
-    std::vector<FrameStats> frameHistory;
-    size_t maxHistory{300};  // 5 seconds at 60 FPS
-    double frameStartTime{0.0};
+    // Times in seconds, the others in their own units
+    struct Summary {
+        uint64_t samples{0};
+        double mean{0.0};
+        double p50{0.0};
+        double p95{0.0};
+        double p99{0.0};
+        double max{0.0};
+    };
+
+    struct SystemCost {
+        const char* name{nullptr};
+        Summary time;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t METRIC_COUNT = static_cast<size_t>(Metric::Count);
+
+    struct SystemSeries {
+        const char* name{nullptr};
+        float frameTime{0.0f};  // accumulated in the open frame
+        CounterSample frameCounters;
+        RingBuffer<float> history;
+        RingBuffer<CounterSample> counterHistory;
+        Histogram lifetime;
+
+        SystemSeries(const char* systemName, size_t capacity)
+            : name(systemName), history(capacity), counterHistory(capacity) {}
+    };
+
+    RingBuffer<FrameStats> frameHistory;
+    Histogram lifetime[METRIC_COUNT];
+    std::vector<SystemSeries> systems;
+    Clock::time_point frameStart;
+    bool started{false};
+    bool frameOpen{false};
+    size_t lastScratchBytes{0};
+    size_t peakScratchBytes{0};
+    AllocationSnapshot allocationTotals;  // as of the previous RecordAllocations
+    AllocationSnapshot frameAllocations;
+    bool haveAllocationTotals{false};
+
+    mutable std::vector<double> scratch;  // window percentile workspace
+
+    SystemSeries* FindSystem(const char* name);
+    SystemSeries& GetOrAddSystem(const char* name);
+    const SystemSeries* FindSystem(const char* name) const;
+    static Summary Summarize(std::vector<double>& values);
+    static Summary Summarize(const Histogram& histogram, double scale);
 
 public:
+    explicit PerformanceMonitor(size_t maxHistory = 300);  // 5 seconds at 60 FPS
+
     void Initialize() {}
     void Shutdown() {}
+    void Reset();
+
+    // Opens a frame; Record* calls until EndFrame apply to it
     void StartFrame();
     void EndFrame();
+    // Overrides the measured interval since the previous StartFrame
+    void RecordFrameTime(float seconds);
     void RecordRenderTime(float time);
     void RecordPhysicsTime(float time);
     void RecordScriptTime(float time);
     void RecordEntityCount(uint32_t count);
     void RecordRenderedEntities(uint32_t count);
+    // Frame arena bytes used by the frame that just ended
+    void RecordScratchUsage(size_t bytes);
+    // Takes the frame's allocations per tag and thread from running totals
+    // (MemoryTracker::TakeSnapshot); the first call only sets the baseline
+    void RecordAllocations(const AllocationSnapshot& totals);
+    // Adds to the named system's time for the open frame; name must be stable.
+    // Engine::UpdateSystems records every system it updates.
+    void RecordSystemTime(const char* name, float seconds);
+    // Adds a system's hardware counters to the open frame; empty samples are ignored
+    void RecordSystemCounters(const char* name, const CounterSample& counters);
+
+    // frames = 0 uses every frame in the history
+    Summary GetWindowStats(Metric metric, size_t frames = 0) const;
+    Summary GetLifetimeStats(Metric metric) const;
+    Summary GetSystemWindowStats(const char* name, size_t frames = 0) const;
+    Summary GetSystemLifetimeStats(const char* name) const;
+    std::vector<const char*> GetSystemNames() const;
+    // Indexed access in first-recorded order, without allocating
+    size_t GetSystemCount() const { return systems.size(); }
+    const char* GetSystemName(size_t index) const { return systems[index].name; }
+    // Seconds in the last completed frame
+    float GetLastSystemTime(size_t index) const {
+        return systems[index].history.Empty() ? 0.0f : systems[index].history.Back();
+    }
+    // Counters summed over the last frames (0 = all held)
+    CounterSample GetSystemCounters(const char* name, size_t frames = 0) const;
+
+    // Most expensive systems by mean time over the last frames (0 = all held)
+    std::vector<SystemCost> GetTopSystems(size_t count, size_t frames = 0) const;
+    // Adds IPC and cache misses per frame when counters were recorded
+    void PrintTopSystems(std::ostream& out, size_t count, size_t frames = 0) const;
+
+    // Frame history as CSV, one row per completed frame, counters included
+    void WriteFrameStatsCsv(std::ostream& out, size_t frames = 0) const;
 
     float GetAverageFPS() const;
     float GetAverageDeltaTime() const;
     float GetAverageRenderTime() const;
-    const auto& GetFrameHistory() const { return frameHistory; }
+    size_t GetLastScratchBytes() const { return lastScratchBytes; }
+    size_t GetPeakScratchBytes() const { return peakScratchBytes; }
+    // Allocations of the last frame passed to RecordAllocations
+    const AllocationSnapshot& GetFrameAllocations() const { return frameAllocations; }
+    const RingBuffer<FrameStats>& GetFrameHistory() const { return frameHistory; }
+};
+
+// ============================================================================
+// Hitch Recorder
+// ============================================================================
+
+// Flight recorder for frame spikes. It keeps the profiler on, so every
+// thread's ring always holds the recent zones. When a frame (the time from
+// the previous OnFrameEnd to this one) takes longer than p95Ratio times the
+// rolling p95 of the frames before it, the recorder
+// waits framesAfter more frames. It then writes the zones of framesBefore
+// frames before the spike, the spike and those after it to a Chrome trace.
+// The events are copied between frames and written on a background thread,
+// and a frame without a hitch costs a few comparisons.
+class TITAN_API HitchRecorder {
+public:
+    struct Config {
+        float p95Ratio{2.0f};         // hitch when frame time > p95Ratio * rolling p95
+        float minFrameTime{0.008f};   // and above this many seconds, so idle jitter is ignored
+        size_t baselineFrames{300};   // rolling p95 window
+        uint32_t framesBefore{30};
+        uint32_t framesAfter{10};
+        uint32_t cooldownFrames{300}; // no new capture this soon after one is written
+        uint32_t maxCaptures{20};     // then the recorder stops capturing
+        std::string outputDirectory{"hitches"};
+    };
+
+    struct Capture {
+        uint64_t frame{0};        // frames seen before the spike
+        float frameTime{0.0f};    // seconds
+        float baselineP95{0.0f};
+        std::string path;
+    };
+
+private:
+    static constexpr uint32_t BASELINE_REFRESH_FRAMES = 30;
+    static constexpr uint64_t MIN_BASELINE_SAMPLES = 30;
+
+    Config config;
+    RingBuffer<uint64_t> frameEnds;  // profiler time at the end of recent frames
+    uint64_t frame{0};
+    float baselineP95{0.0f};
+    uint64_t baselineSamples{0};
+    bool pending{false};
+    uint32_t framesUntilWrite{0};
+    uint32_t cooldown{0};
+    uint64_t windowStart{0};  // end of the frame before the captured window
+    std::vector<Capture> captures;
+    std::thread writer;
+
+    void WriteCapture();
+
+public:
+    HitchRecorder() : HitchRecorder(Config()) {}
+    explicit HitchRecorder(const Config& recorderConfig);
+    ~HitchRecorder();
+
+    HitchRecorder(const HitchRecorder&) = delete;
+    HitchRecorder& operator=(const HitchRecorder&) = delete;
+
+    // Turns the profiler on; the recorder only sees zones recorded from here
+    void Start();
+    // Call once per frame after PerformanceMonitor::EndFrame, between frames.
+    // A capture copies every thread's profiler ring (Profiler::Collect), so no
+    // other thread may be recording zones then: the frame's jobs must be done.
+    void OnFrameEnd(const PerformanceMonitor& monitor);
+    // Waits for the trace being written, if any
+    void Flush();
+
+    const Config& GetConfig() const { return config; }
+    // Triggered captures, including one still waiting for its later frames
+    const std::vector<Capture>& GetCaptures() const { return captures; }
 };
 
 } // namespace Titan
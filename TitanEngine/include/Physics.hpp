@@ -6,22 +6,41 @@
 
 namespace Titan {
 
+class JobSystem;
+
 // ============================================================================
 // Physics System Interface
 // ============================================================================
 
 class PhysicsSystem : public ISystem {
+protected:
+    EntityManager* entityManager{nullptr};
+    JobSystem* jobs{nullptr};
+
 public:
     virtual ~PhysicsSystem() = default;
 
+    // World this system simulates; jobs may be null to run on the calling thread
+    void SetWorld(EntityManager* world, JobSystem* jobSystem) {
+        entityManager = world;
+        jobs = jobSystem;
+    }
+
     virtual void Initialize() override = 0;
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    // Integrates every Transform/RigidBody pair
+    const char* GetName() const override { return "Physics"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Write<Transform>().Write<RigidBody>();
+    }
+
     virtual void SetGravity(const glm::vec3& gravity) = 0;
     virtual glm::vec3 GetGravity() const = 0;
 
-    virtual void AddRigidBody(EntityID entityID, const std::shared_ptr<RigidBody>& body) = 0;
+    virtual void AddRigidBody(EntityID entityID, const RigidBody& body) = 0;
     virtual void RemoveRigidBody(EntityID entityID) = 0;
 
     virtual void Raycast(const glm::vec3& origin, const glm::vec3& direction, 
@@ -35,7 +54,6 @@ public:
 class SimplePhysicsSystem : public PhysicsSystem {
 private:
     glm::vec3 gravity{0.0f, -9.81f, 0.0f};
-    std::unordered_map<EntityID, std::shared_ptr<RigidBody>> rigidBodies;
 
 public:
     void Initialize() override;
@@ -45,14 +63,14 @@ public:
     void SetGravity(const glm::vec3& g) override { gravity = g; }
     glm::vec3 GetGravity() const override { return gravity; }
 
-    void AddRigidBody(EntityID entityID, const std::shared_ptr<RigidBody>& body) override;
+    void AddRigidBody(EntityID entityID, const RigidBody& body) override;
     void RemoveRigidBody(EntityID entityID) override;
 
     void Raycast(const glm::vec3& origin, const glm::vec3& direction,
                 float maxDistance, std::vector<EntityID>& outHits) override;
 
 private:
-    void UpdateRigidBody(EntityID entityID, float dt);
+    void UpdateRigidBody(Transform& transform, RigidBody& rigidBody, float dt);
 };
 
 } // namespace Titan
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include "HardwareCounters.hpp"
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Set to 0 (CMake: TITAN_ENABLE_PROFILER=OFF) to compile every zone out
+#ifndef TITAN_PROFILING
+#define TITAN_PROFILING 1
+#endif
+
+namespace Titan {
+
+// ============================================================================
+// Profiler
+// ============================================================================
+
+// Process-wide zone profiler. Each thread appends the zones it closes to its
+// own ring buffer without locks; the newest events win once a buffer is full.
+// Recording is off until SetEnabled(true), and a disabled zone costs one
+// relaxed atomic load. Zone names must outlive the profiler (string literals,
+// ISystem::GetName). While HardwareCounters are enabled too, each zone also
+// records the CPU counters of its thread from open to close.
+//
+// Collect, Clear and the trace writers read every thread's buffer: call them
+// while nothing is recording, e.g. after SetEnabled(false) between frames.
+class TITAN_API Profiler {
+public:
+    struct Event {
+        const char* name{nullptr};
+        uint64_t startNs{0};  // since the profiler's epoch
+        uint64_t endNs{0};
+        uint32_t depth{0};    // 0 for outermost zones
+        CounterSample counters;  // empty unless HardwareCounters were enabled
+    };
+
+    struct ThreadEvents {
+        uint32_t threadId{0};
+        std::string threadName;
+        std::vector<Event> events;  // in order of completion
+        uint64_t dropped{0};        // overwritten once the ring was full
+    };
+
+    static void SetEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // Events kept per thread; applies to buffers created afterwards
+    static void SetBufferCapacity(size_t events);
+
+    // Shown as the thread's track name in trace viewers
+    static void SetThreadName(const std::string& name);
+
+    // Innermost zone open on this thread while recording, else null
+    static const char* CurrentZone() { return Zone(); }
+
+    static uint64_t Now();
+    static void Record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth,
+                       const CounterSample* counters = nullptr);
+
+    // Events overlapping [fromNs, toNs]; every held event by default
+    static std::vector<ThreadEvents> Collect(uint64_t fromNs = 0, uint64_t toNs = UINT64_MAX);
+    static void Clear();
+
+    // Chrome trace event JSON, loadable in chrome://tracing and Perfetto;
+    // hardware counters appear as each zone's args
+    static void WriteChromeTrace(std::ostream& out);
+    static bool WriteChromeTrace(const std::string& path);
+    // Writes events collected earlier; safe while other threads record
+    static void WriteChromeTrace(std::ostream& out, const std::vector<ThreadEvents>& threads);
+
+private:
+    static std::atomic<bool> enabled;
+
+    friend class ProfileScope;
+    static uint32_t& Depth();
+    static const char*& Zone();
+};
+
+// Records one zone from construction to destruction
+class ProfileScope {
+private:
+    const char* name{nullptr};
+    const char* outer{nullptr};
+    uint64_t start{0};
+    uint32_t depth{0};
+    bool counting{false};
+    CounterSample startCounters;
+
+public:
+    explicit ProfileScope(const char* zoneName) {
+        if (!Profiler::IsEnabled()) return;
+        name = zoneName;
+        outer = Profiler::Zone();
+        Profiler::Zone() = zoneName;
+        depth = Profiler::Depth()++;
+        counting = HardwareCounters::Read(startCounters);
+        start = Profiler::Now();
+    }
+
+    ~ProfileScope() {
+        if (!name) return;
+        uint64_t end = Profiler::Now();
+        CounterSample counters;
+        if (counting && HardwareCounters::Read(counters)) {
+            counters = counters.Since(startCounters);
+            Profiler::Record(name, start, end, depth, &counters);
+        } else {
+            Profiler::Record(name, start, end, depth);
+        }
+        --Profiler::Depth();
+        Profiler::Zone() = outer;
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+} // namespace Titan
+
+#define TITAN_PROFILE_CONCAT_INNER(a, b) a##b
+#define TITAN_PROFILE_CONCAT(a, b) TITAN_PROFILE_CONCAT_INNER(a, b)
+
+#if TITAN_PROFILING
+#define TITAN_PROFILE_SCOPE(name) ::Titan::ProfileScope TITAN_PROFILE_CONCAT(titanProfileScope, __LINE__)(name)
+#else
+#define TITAN_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -124,6 +124,13 @@ public:
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
 
+    // Graphics API calls stay on the thread that owns the context
+    const char* GetName() const override { return "Renderer"; }
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Read<Transform>().Read<Renderable>().WriteResource("Renderer").MainThreadOnly();
+    }
+
     virtual void BeginFrame() = 0;
     virtual void EndFrame() = 0;
     virtual void Present() = 0;
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Core.hpp"
+#include "Jobs.hpp"
+#include "Memory.hpp"
+#include "HardwareCounters.hpp"
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace Titan {
+
+// ============================================================================
+// System Scheduler
+// ============================================================================
+
+// Runs ISystem::Update for a list of systems, in parallel where their declared
+// SystemAccess allows it. Conflicting systems keep their registration order:
+// for every pair i < j that conflicts, j waits for i. Systems run as jobs on
+// the JobSystem; the calling thread joins in each frame and is the only one
+// that runs MainThreadOnly systems.
+class TITAN_API SystemScheduler {
+private:
+    struct Node {
+        ISystem* system{nullptr};
+        SystemAccess access;
+        std::vector<size_t> dependencies;
+        std::vector<size_t> dependents;
+        float lastUpdateTime{0.0f};  // written only by the thread running the system
+        MemoryTag memoryTag{UNTAGGED_MEMORY};
+        CounterSample lastCounters;   // empty unless HardwareCounters are enabled
+    };
+
+    JobSystem& jobs;
+    std::vector<Node> nodes;
+
+    // Per-frame state, guarded by mutex
+    std::mutex mutex;
+    std::deque<size_t> mainQueue;
+    std::vector<size_t> pending;
+    size_t remaining{0};
+    float frameDelta{0.0f};
+    std::exception_ptr firstError;
+
+public:
+    // A job system without workers runs every system sequentially
+    explicit SystemScheduler(JobSystem& jobSystem);
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    // Rebuilds the dependency graph; call whenever the system list changes
+    void SetSystems(const std::vector<ISystem*>& systems);
+
+    // Updates every system once. Rethrows the first exception a system threw
+    // after all the others have finished.
+    void Run(float deltaTime);
+
+    size_t GetSystemCount() const { return nodes.size(); }
+    const std::vector<size_t>& GetDependencies(size_t index) const { return nodes[index].dependencies; }
+    ISystem* GetSystem(size_t index) const { return nodes[index].system; }
+    // Seconds the system's Update took in the last Run
+    float GetLastUpdateTime(size_t index) const { return nodes[index].lastUpdateTime; }
+    // CPU counters over that Update, while HardwareCounters are enabled
+    const CounterSample& GetLastCounters(size_t index) const { return nodes[index].lastCounters; }
+
+private:
+    void Execute(size_t index);
+    void Update(Node& node, float deltaTime);
+    void Complete(size_t index);
+    void Dispatch(size_t index);
+};
+
+} // namespace Titan
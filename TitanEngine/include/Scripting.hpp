@@ -9,17 +9,26 @@
 
 namespace Titan {
 
+class Engine;
+
 // ============================================================================
 // Scripting System Interface
 // ============================================================================
 
 class ScriptingSystem : public ISystem {
+protected:
+    Engine* engine{nullptr};
+
 public:
     virtual ~ScriptingSystem() = default;
 
+    // Engine the script bindings act on; set before Initialize
+    void SetEngine(Engine* owner) { engine = owner; }
+
     virtual void Initialize() override = 0;
     virtual void Update(float deltaTime) override = 0;
     virtual void Shutdown() override = 0;
+    const char* GetName() const override { return "Scripting"; }
 
     // Lua script execution
     virtual bool ExecuteScript(const std::string& scriptPath) = 0;
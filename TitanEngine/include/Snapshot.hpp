@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Titan {
+
+// ============================================================================
+// World Snapshot
+// ============================================================================
+
+// Complete copy of an EntityManager (entity table, names, every component)
+// kept in one contiguous buffer, for rollback and instant round resets.
+//
+// Component columns are copied chunk by chunk: memcpy for plain components
+// (IsPlainComponent), copy construction / assignment for the rest. While the
+// world's structure is unchanged since the snapshot last matched it (same
+// entities, component sets and names), Capture and Restore are deltas that
+// copy only the chunk columns written in the meantime, using the same change
+// versions as View::Changed. Writes through component pointers fetched before
+// a Capture or Restore are not seen by the next delta.
+//
+// Capture and Restore between frames: Restore drops pending command buffers.
+class TITAN_API WorldSnapshot {
+public:
+    struct Stats {
+        size_t bufferBytes{0};  // component and entity data held
+        size_t copiedBytes{0};  // copied by the last Capture or Restore
+        bool delta{false};      // last operation only copied changed columns
+    };
+
+private:
+    static constexpr uint32_t NO_ARCHETYPE = ~0u;
+
+    struct ArchetypeState {
+        std::vector<ComponentTypeInfo> types;
+        uint32_t entityCount{0};
+        Archetype* live{nullptr};  // the world's archetype while the layout matches
+    };
+
+    // One chunk column stored at offset in the buffer; column -1 holds entity IDs
+    struct Segment {
+        uint32_t archetype{0};
+        uint32_t chunk{0};
+        int32_t column{-1};
+        uint32_t count{0};
+        size_t offset{0};
+    };
+
+    struct SlotState {
+        uint32_t archetype{NO_ARCHETYPE};
+        uint32_t row{0};
+        uint32_t generation{0};
+        uint32_t nextFree{0};
+        uint32_t nameOffset{0};
+        uint32_t nameLength{0};
+        bool active{true};
+    };
+
+    std::vector<ArchetypeState> archetypes;
+    std::vector<Segment> segments;
+    std::vector<SlotState> slots;
+    std::string names;  // every entity name, back to back
+    uint32_t freeHead{0};
+    uint32_t freeTail{0};
+    size_t entityCount{0};
+
+    uint8_t* buffer{nullptr};
+    size_t bufferSize{0};
+    size_t bufferCapacity{0};
+
+    bool captured{false};
+    uint64_t ownerSerial{0};      // world the layout currently matches
+    uint64_t layoutVersion{0};    // its structural version at that point
+    uint32_t capturedVersion{0};  // its change version the buffer is current at
+
+    std::vector<uint8_t> gameState;
+    Stats stats;
+
+public:
+    WorldSnapshot() = default;
+    ~WorldSnapshot();
+
+    WorldSnapshot(const WorldSnapshot&) = delete;
+    WorldSnapshot& operator=(const WorldSnapshot&) = delete;
+
+    // Throws if a component that is not plain cannot be copied
+    void Capture(EntityManager& world);
+
+    // Puts the world back to the captured state. May target a different
+    // EntityManager than the one captured, e.g. to fork a world.
+    void Restore(EntityManager& world);
+
+    bool IsCaptured() const { return captured; }
+    void Reset();
+
+    // Extra state saved alongside the world; Engine keeps gamemode state here
+    std::vector<uint8_t>& GetGameState() { return gameState; }
+    const std::vector<uint8_t>& GetGameState() const { return gameState; }
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    bool MatchesLayout(const EntityManager& world) const;
+    void CaptureFull(EntityManager& world);
+    void RestoreFull(EntityManager& world);
+    void CopyColumns(bool toWorld, bool onlyChanged);
+    void DestroyStoredComponents();
+    uint8_t* SegmentData(const Segment& segment) const { return buffer + segment.offset; }
+};
+
+} // namespace Titan
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace Titan {
+
+class PerformanceMonitor;
+struct NetworkStats;
+struct TelemetrySegment;
+
+// ============================================================================
+// Telemetry
+// ============================================================================
+
+static constexpr uint32_t TELEMETRY_VERSION = 1;
+static constexpr uint32_t TELEMETRY_MAX_SYSTEMS = 64;
+static constexpr uint32_t TELEMETRY_NAME_LENGTH = 32;  // including the terminator
+
+// One published frame. Plain data: it is copied word by word through shared
+// memory, so its layout is the wire format (bump TELEMETRY_VERSION on change).
+struct TelemetryFrame {
+    uint64_t frameIndex{0};        // frames published before this one
+    uint64_t timestampNs{0};       // publisher's steady clock
+    float deltaTime{0.0f};
+    float workTime{0.0f};
+    float renderTime{0.0f};
+    float physicsTime{0.0f};
+    float scriptTime{0.0f};
+    uint32_t entityCount{0};
+    uint32_t renderedEntities{0};
+    uint32_t connectedPlayers{0};
+    uint64_t scratchBytes{0};
+    uint64_t allocations{0};
+    uint64_t allocatedBytes{0};
+    // Network running totals; readers take differences
+    uint64_t messagesSent{0};
+    uint64_t messagesReceived{0};
+    uint64_t bytesSent{0};
+    uint64_t bytesReceived{0};
+    uint32_t systemCount{0};
+    float systemTimes[TELEMETRY_MAX_SYSTEMS]{};  // seconds, by TelemetryReader::GetSystemName index
+};
+
+static_assert(std::is_trivially_copyable_v<TelemetryFrame>, "TelemetryFrame is copied as raw words");
+static_assert(sizeof(TelemetryFrame) % sizeof(uint64_t) == 0, "TelemetryFrame must be whole words");
+
+// Publishes frames into a named shared memory segment (POSIX shm_open, a
+// named file mapping on Windows) holding a ring of the last capacity frames.
+// Each slot is a seqlock: Publish only stores, so the game thread never
+// waits on readers, and readers detect and skip frames that were being
+// overwritten. Any number of reader processes may attach.
+class TITAN_API TelemetryPublisher {
+private:
+    TelemetrySegment* segment{nullptr};
+    size_t mappedBytes{0};
+    void* mappingHandle{nullptr};  // Windows file mapping
+    std::string segmentName;
+    uint64_t published{0};
+    uint32_t systemNames{0};  // names already written to the segment
+
+public:
+    TelemetryPublisher() = default;
+    ~TelemetryPublisher();
+
+    TelemetryPublisher(const TelemetryPublisher&) = delete;
+    TelemetryPublisher& operator=(const TelemetryPublisher&) = delete;
+
+    // Creates (or takes over) the segment; false if shared memory is unavailable
+    bool Open(const std::string& name, uint32_t capacity = 256);
+    // Unmaps and removes the segment; attached readers keep their mapping
+    void Close();
+    bool IsOpen() const { return segment != nullptr; }
+
+    // Frame index and timestamp are filled in here
+    void Publish(TelemetryFrame frame);
+    // The monitor's last completed frame and per-system times; call after EndFrame
+    void Publish(const PerformanceMonitor& monitor, const NetworkStats* network = nullptr,
+                 uint32_t connectedPlayers = 0);
+
+    uint64_t GetPublishedCount() const { return published; }
+};
+
+// Read-only view of a segment written by a TelemetryPublisher, usually in
+// another process
+class TITAN_API TelemetryReader {
+private:
+    const TelemetrySegment* segment{nullptr};
+    size_t mappedBytes{0};
+    void* mappingHandle{nullptr};
+
+public:
+    TelemetryReader() = default;
+    ~TelemetryReader();
+
+    TelemetryReader(const TelemetryReader&) = delete;
+    TelemetryReader& operator=(const TelemetryReader&) = delete;
+
+    // False if no publisher created the segment or its version differs
+    bool Open(const std::string& name);
+    void Close();
+    bool IsOpen() const { return segment != nullptr; }
+
+    uint32_t GetCapacity() const;
+    // Frames published so far; the newest has index GetPublishedCount() - 1
+    uint64_t GetPublishedCount() const;
+    // False if the frame was overwritten, not yet published or being written
+    bool ReadFrame(uint64_t frameIndex, TelemetryFrame& out) const;
+    bool ReadLatest(TelemetryFrame& out) const;
+
+    uint32_t GetSystemCount() const;
+    const char* GetSystemName(uint32_t index) const;
+};
+
+} // namespace Titan
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "TitanExports.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace Titan {
+
+// ============================================================================
+// Fixed Timestep
+// ============================================================================
+
+// Accumulator that turns variable frame times into whole simulation ticks of
+// a fixed length. Each frame, Advance() adds the real elapsed time and returns
+// how many ticks to run (0..maxTicksPerFrame); the leftover fraction of a tick
+// is GetAlpha(), for blending the last two simulation states when rendering.
+//
+// Spiral-of-death guard: if more than maxTicksPerFrame ticks are due (a hitch,
+// or a server that cannot keep up), the excess whole ticks are dropped instead
+// of being carried into the next frame, so simulation slows down rather than
+// falling further behind every frame. Dropped ticks are counted.
+class TITAN_API FixedTimestep {
+private:
+    double step;
+    uint32_t maxTicksPerFrame;
+    double accumulator{0.0};
+    uint64_t tickCount{0};
+    uint64_t droppedTicks{0};
+
+public:
+    explicit FixedTimestep(uint32_t tickRate = 60, uint32_t maxTicks = 5);
+
+    // Returns the number of ticks to run for a frame that took frameSeconds
+    uint32_t Advance(double frameSeconds);
+
+    float GetStep() const { return static_cast<float>(step); }
+    uint32_t GetTickRate() const { return static_cast<uint32_t>(1.0 / step + 0.5); }
+
+    // Fraction of a tick accumulated but not simulated yet, in [0, 1)
+    float GetAlpha() const { return static_cast<float>(accumulator / step); }
+
+    uint64_t GetTickCount() const { return tickCount; }
+    uint64_t GetDroppedTicks() const { return droppedTicks; }
+    double GetSimulationTime() const { return tickCount * step; }
+
+    void Reset();
+};
+
+// ============================================================================
+// Frame Pacer
+// ============================================================================
+
+// Holds the frame rate to a target with sub-millisecond precision. Deadlines
+// come from an absolute schedule (start + n * interval), so per-frame errors
+// never accumulate into drift. Each wait sleeps until shortly before the
+// deadline, then spins with a CPU pause hint for the rest. The safety margin
+// before the deadline adapts to how far the OS actually oversleeps.
+//
+// A frame that overruns its deadline is counted as missed. If it overran by
+// more than a whole interval, the schedule restarts from now rather than
+// running a burst of short catch-up frames.
+class TITAN_API FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Wake-up error relative to the deadline, in microseconds, over paced frames
+    struct Stats {
+        uint64_t frames{0};
+        uint64_t missedFrames{0};
+        double meanErrorUs{0.0};
+        double maxErrorUs{0.0};
+        double stdDevErrorUs{0.0};
+        double spinMarginUs{0.0};
+    };
+
+private:
+    Clock::duration interval{0};
+    Clock::time_point nextDeadline;
+    Clock::duration spinMargin;
+    bool started{false};
+
+    // Running error statistics (Welford)
+    uint64_t pacedFrames{0};
+    uint64_t missedFrames{0};
+    double errorMean{0.0};
+    double errorM2{0.0};
+    double errorMax{0.0};
+
+public:
+    // targetFPS 0 disables pacing
+    explicit FramePacer(uint32_t targetFPS = 60);
+
+    void SetTargetFPS(uint32_t targetFPS);
+
+    // Starts the schedule at now; WaitForNextFrame calls it if needed
+    void Start();
+
+    // Blocks until the next deadline of the schedule
+    void WaitForNextFrame();
+
+    Stats GetStats() const;
+    void ResetStats();
+};
+
+} // namespace Titan
@@ -1,6 +1,10 @@
 #pragma once
 
-#ifdef TITANENGINE_EXPORTS
+// Symbols are exported from the engine DLL on Windows; elsewhere, and when
+// the engine is linked statically (TITAN_STATIC), no decoration is needed
+#if !defined(_WIN32) || defined(TITAN_STATIC)
+#define TITAN_API
+#elif defined(TITANENGINE_EXPORTS)
 #define TITAN_API __declspec(dllexport)
 #else
 #define TITAN_API __declspec(dllimport)
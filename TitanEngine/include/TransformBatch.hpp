@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Core.hpp"
+#include "TitanExports.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+
+namespace Titan {
+
+// ============================================================================
+// Batch Transform Kernel
+// ============================================================================
+
+// Structure-of-arrays input: component k of position/rotation/scale for
+// transform i is position[k][i] and so on. Rotation is Euler radians, as in
+// Transform.
+struct TransformArrays {
+    const float* position[3]{};
+    const float* rotation[3]{};
+    const float* scale[3]{};
+    size_t count{0};
+};
+
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+// Best kernel this CPU and build support
+TITAN_API SimdLevel GetSimdLevel();
+TITAN_API const char* GetSimdLevelName(SimdLevel level);
+
+// Writes the model matrix of every transform (same convention as
+// Transform::GetModelMatrix: T * Rz * Ry * Rx * S) to out. Sin/cos use a
+// polynomial shared by all levels; every level produces bit-identical
+// results, accurate to a few ulp for angles within +-1e4 radians. Levels the
+// CPU lacks fall back to the best supported one.
+TITAN_API void ComputeModelMatrices(const TransformArrays& transforms, glm::mat4* out,
+                                    SimdLevel level = GetSimdLevel());
+
+// Same for an array of Transform components; gathers them into SoA blocks in
+// the thread scratch arena first
+TITAN_API void ComputeModelMatrices(const Transform* transforms, size_t count, glm::mat4* out);
+
+} // namespace Titan
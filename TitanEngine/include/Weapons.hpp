@@ -62,6 +62,11 @@ public:
     void Update(float deltaTime);
 };
 
+template<> struct IsPlainComponent<WeaponComponent>
+    : PlainComponentMembers<decltype(WeaponComponent::stats), decltype(WeaponComponent::ammoInMag),
+                            decltype(WeaponComponent::totalAmmo), decltype(WeaponComponent::timeSinceLastShot),
+                            decltype(WeaponComponent::isReloading), decltype(WeaponComponent::reloadProgress)> {};
+
 // ============================================================================
 // Inventory Component
 // ============================================================================
@@ -118,6 +123,15 @@ public:
     void Respawn();
 };
 
+template<> struct IsPlainComponent<PlayerController>
+    : PlainComponentMembers<decltype(PlayerController::health), decltype(PlayerController::maxHealth),
+                            decltype(PlayerController::armor), decltype(PlayerController::maxArmor),
+                            decltype(PlayerController::moveSpeed), decltype(PlayerController::sprintSpeed),
+                            decltype(PlayerController::isSprinting), decltype(PlayerController::crouchSpeed),
+                            decltype(PlayerController::isCrouching), decltype(PlayerController::isDead),
+                            decltype(PlayerController::team), decltype(PlayerController::killCount),
+                            decltype(PlayerController::deathCount), decltype(PlayerController::assistCount)> {};
+
 // ============================================================================
 // Damage Info
 // ============================================================================
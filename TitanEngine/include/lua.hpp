@@ -25,8 +25,11 @@ inline int lua_gettop(lua_State*) { return 0; }
 inline int lua_isstring(lua_State*, int) { return 0; }
 inline int lua_isnumber(lua_State*, int) { return 0; }
 inline int lua_isinteger(lua_State*, int) { return 0; }
+inline int lua_toboolean(lua_State*, int) { return 0; }
 inline double lua_tonumber(lua_State*, int) { return 0.0; }
 inline lua_Integer lua_tointeger(lua_State*, int) { return 0; }
+inline int luaL_error(lua_State*, const char*, ...) { return 0; }
+inline void* lua_getextraspace(lua_State*) { static void* space[1] = {}; return space; }
 
 #ifndef LUA_OK
 #define LUA_OK 0
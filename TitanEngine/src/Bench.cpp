@@ -0,0 +1,263 @@
+// Micro-benchmarks for engine hot paths. Headless: nothing here opens a
+// window, a device or a socket.
+//
+// usage: TitanBench [--filter text] [--repetitions n] [--warmup ms]
+//                   [--min-sample ms] [--json path] [--list]
+//        TitanBench --compare baseline.json current.json [--threshold percent]
+
+#include "../include/BenchmarkFramework.hpp"
+#include "../include/Core.hpp"
+#include "../include/CoreMath.hpp"
+#include "../include/Effects.hpp"
+#include "../include/NetworkingUDP.hpp"
+#include "../include/Performance.hpp"
+#include "../include/TitanEditor.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+using namespace Titan;
+using Titan::Bench::DoNotOptimize;
+
+static constexpr int WORLD_SIZE = 10000;
+static constexpr size_t LOOKUPS = 1024;
+
+// Deterministic positions inside a cube of half size extent
+static std::vector<glm::vec3> RandomPositions(size_t count, float extent, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coordinate(-extent, extent);
+    std::vector<glm::vec3> positions(count);
+    for (glm::vec3& position : positions) {
+        position = glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+    }
+    return positions;
+}
+
+// Lookup order that defeats the prefetcher
+static std::vector<EntityID> ShuffledIds(std::vector<EntityID> ids, uint32_t seed) {
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(seed));
+    ids.resize(std::min(ids.size(), LOOKUPS));
+    return ids;
+}
+
+static std::vector<EntityID> PopulateWorld(EntityManager& world, int count) {
+    std::vector<EntityID> ids;
+    for (int i = 0; i < count; ++i) {
+        EntityID id = world.CreateEntity();
+        world.AddComponent<Transform>(id, glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        if (i % 2 == 0) world.AddComponent<RigidBody>(id);
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+// ============================================================================
+// Entity Manager
+// ============================================================================
+
+REGISTER_BENCHMARK(EntityCreateDestroy, "EntityManager/CreateDestroy") {
+    EntityManager world;
+    PopulateWorld(world, WORLD_SIZE);
+    state.Measure([&]() {
+        EntityID id = world.CreateEntity();
+        world.AddComponent<Transform>(id);
+        world.DestroyEntity(id);
+    });
+}
+
+REGISTER_BENCHMARK(EntityLookup, "EntityManager/Lookup") {
+    EntityManager world;
+    std::vector<EntityID> ids = ShuffledIds(PopulateWorld(world, WORLD_SIZE), 1);
+    state.Measure([&]() {
+        size_t valid = 0;
+        for (EntityID id : ids) valid += world.GetEntity(id).IsValid();
+        DoNotOptimize(valid);
+    }, ids.size());
+}
+
+REGISTER_BENCHMARK(EntityGetComponent, "EntityManager/GetComponent") {
+    EntityManager world;
+    std::vector<EntityID> ids = ShuffledIds(PopulateWorld(world, WORLD_SIZE), 2);
+    state.Measure([&]() {
+        float sum = 0.0f;
+        for (EntityID id : ids) sum += world.GetComponent<Transform>(id)->position.x;
+        DoNotOptimize(sum);
+    }, ids.size());
+}
+
+// ============================================================================
+// Spatial Hash
+// ============================================================================
+
+REGISTER_BENCHMARK(SpatialHashInsert, "SpatialHash/Insert") {
+    std::vector<glm::vec3> positions = RandomPositions(LOOKUPS, 500.0f, 3);
+    SpatialHash hash(50.0f);
+    state.Measure([&]() {
+        hash.Clear();
+        for (size_t i = 0; i < positions.size(); ++i) hash.Insert(static_cast<EntityID>(i + 1), positions[i]);
+    }, positions.size());
+}
+
+REGISTER_BENCHMARK(SpatialHashUpdate, "SpatialHash/Update") {
+    std::vector<glm::vec3> from = RandomPositions(LOOKUPS, 500.0f, 4);
+    std::vector<glm::vec3> to = RandomPositions(LOOKUPS, 500.0f, 5);
+    SpatialHash hash(50.0f);
+    for (size_t i = 0; i < from.size(); ++i) hash.Insert(static_cast<EntityID>(i + 1), from[i]);
+    state.Measure([&]() {
+        // Out and back, so every call starts from the same layout
+        for (size_t i = 0; i < from.size(); ++i) hash.Update(static_cast<EntityID>(i + 1), from[i], to[i]);
+        for (size_t i = 0; i < from.size(); ++i) hash.Update(static_cast<EntityID>(i + 1), to[i], from[i]);
+    }, from.size() * 2);
+}
+
+REGISTER_BENCHMARK(SpatialHashQuery, "SpatialHash/QuerySphere") {
+    std::vector<glm::vec3> positions = RandomPositions(WORLD_SIZE, 500.0f, 6);
+    std::vector<glm::vec3> centers = RandomPositions(256, 500.0f, 7);
+    SpatialHash hash(50.0f);
+    for (size_t i = 0; i < positions.size(); ++i) hash.Insert(static_cast<EntityID>(i + 1), positions[i]);
+    std::vector<EntityID> found;
+    state.Measure([&]() {
+        size_t total = 0;
+        for (const glm::vec3& center : centers) {
+            hash.QuerySphere(center, 40.0f, found);
+            total += found.size();
+        }
+        DoNotOptimize(total);
+    }, centers.size());
+}
+
+// ============================================================================
+// Culling and Math
+// ============================================================================
+
+REGISTER_BENCHMARK(FrustumContains, "Frustum/ContainsAABB") {
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(100.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    Frustum frustum = Frustum::FromViewProjection(projection * view);
+    std::vector<AABB> boxes;
+    for (const glm::vec3& position : RandomPositions(LOOKUPS, 500.0f, 8)) {
+        boxes.push_back(AABB{ position - glm::vec3(1.0f), position + glm::vec3(1.0f) });
+    }
+    state.Measure([&]() {
+        size_t visible = 0;
+        for (const AABB& box : boxes) visible += frustum.Contains(box);
+        DoNotOptimize(visible);
+    }, boxes.size());
+}
+
+REGISTER_BENCHMARK(RayAABB, "CoreMath/RayIntersectsAABB") {
+    std::vector<glm::vec3> targets = RandomPositions(LOOKUPS, 100.0f, 9);
+    state.Measure([&]() {
+        size_t hits = 0;
+        for (const glm::vec3& target : targets) {
+            float t = 0.0f;
+            hits += RayIntersectsAABB(glm::vec3(0.0f), glm::normalize(target + glm::vec3(0.5f)),
+                                      target - glm::vec3(1.0f), target + glm::vec3(1.0f), t);
+        }
+        DoNotOptimize(hits);
+    }, targets.size());
+}
+
+REGISTER_BENCHMARK(BallisticArc, "CoreMath/SolveBallisticArc") {
+    std::vector<glm::vec3> targets = RandomPositions(LOOKUPS, 200.0f, 10);
+    state.Measure([&]() {
+        float flight = 0.0f;
+        for (const glm::vec3& target : targets) {
+            if (auto solution = SolveBallisticArc(glm::vec3(0.0f), target, 120.0f, 9.81f)) {
+                flight += solution->timeOfFlight;
+            }
+        }
+        DoNotOptimize(flight);
+    }, targets.size());
+}
+
+// ============================================================================
+// Performance Monitor
+// ============================================================================
+
+REGISTER_BENCHMARK(MonitorFrame, "HitchRecorder/SteadyFrame") {
+    PerformanceMonitor monitor;
+    HitchRecorder recorder;
+    state.Measure([&]() {
+        // Steady frames: what the recorder costs while nothing hitches
+        monitor.StartFrame();
+        monitor.RecordFrameTime(1.0f / 60.0f);
+        monitor.RecordSystemTime("Physics", 0.002f);
+        monitor.EndFrame();
+        recorder.OnFrameEnd(monitor);
+    });
+}
+
+// ============================================================================
+// Effects
+// ============================================================================
+
+REGISTER_BENCHMARK(ParticleUpdate, "ParticleEmitter/Update10k") {
+    std::srand(11);
+    ParticleEmitter emitter;
+    emitter.Emit(glm::vec3(0.0f), 10000);
+    state.Measure([&]() {
+        // Respawn what died so the population stays at 10k
+        emitter.Update(1.0f / 60.0f);
+        emitter.Emit(glm::vec3(0.0f), 10000 - static_cast<int>(emitter.particles.size()));
+    });
+}
+
+// ============================================================================
+// Networking
+// ============================================================================
+
+REGISTER_BENCHMARK(SnapshotPacket, "UDPServer/SnapshotPacket64") {
+    std::vector<Snapshot> snapshots(64);
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        snapshots[i] = Snapshot{ 0, static_cast<float>(i), 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 100 };
+    }
+    std::vector<uint8_t> packet(GetSnapshotPacketSize(static_cast<uint32_t>(snapshots.size())));
+    uint32_t tick = 0;
+    state.Measure([&]() {
+        // What the server writes and each client reads per broadcast
+        WriteSnapshotPacket(++tick, snapshots.data(), static_cast<uint32_t>(snapshots.size()), packet.data());
+        uint32_t readTick = 0;
+        float sum = 0.0f;
+        ReadSnapshotPacket(packet.data(), packet.size(), readTick, [&](const Snapshot& s) { sum += s.x; });
+        DoNotOptimize(sum);
+    });
+}
+
+// ============================================================================
+// Editor
+// ============================================================================
+
+static std::string TempMapPath() {
+    return (std::filesystem::temp_directory_path() / "titan_bench_map.txt").string();
+}
+
+static void FillMap(TitanEditor& editor) {
+    for (int i = 0; i < 1000; ++i) {
+        EditorEntity* entity = editor.GetEntity(editor.CreateEntity("Prop" + std::to_string(i)));
+        entity->position = Vec3{ static_cast<float>(i), 1.0f, 2.0f };
+        entity->meshPath = "models/crate.obj";
+        entity->materialPath = "materials/wood.mat";
+    }
+}
+
+REGISTER_BENCHMARK(MapSave, "TitanEditor/SaveMap1000") {
+    TitanEditor editor;
+    FillMap(editor);
+    std::string path = TempMapPath();
+    state.Measure([&]() { editor.SaveMap(path); });
+    std::remove(path.c_str());
+}
+
+REGISTER_BENCHMARK(MapLoad, "TitanEditor/LoadMap1000") {
+    TitanEditor editor;
+    FillMap(editor);
+    std::string path = TempMapPath();
+    editor.SaveMap(path);
+    state.Measure([&]() { editor.LoadMap(path); });
+    std::remove(path.c_str());
+}
+
+int main(int argc, char** argv) {
+    return Titan::Bench::RunMain(argc, argv);
+}
@@ -0,0 +1,110 @@
+// Job system stress test and benchmark.
+// Measures per-job scheduling overhead and ParallelFor scaling from 1 to N threads.
+//
+// usage: TitanJobBench [maxThreads]
+
+#include "../include/Jobs.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace Titan;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Empty jobs: what the scheduler itself costs
+static double MeasureJobOverheadNs(JobSystem& jobs, int jobCount) {
+    auto start = Clock::now();
+    JobCounter counter;
+    for (int i = 0; i < jobCount; ++i) {
+        jobs.Run([]() {}, &counter);
+    }
+    jobs.Wait(counter);
+    return ElapsedMs(start) * 1e6 / jobCount;
+}
+
+// Chains of dependent jobs fanned out from one root; checks every job ran
+static bool StressDependencies(JobSystem& jobs, int chains, int depth) {
+    std::atomic<int> executed{0};
+    std::vector<JobCounter> links(static_cast<size_t>(chains) * depth);
+    JobCounter done;
+
+    for (int c = 0; c < chains; ++c) {
+        jobs.Run([&executed]() { executed++; }, &links[c * depth]);
+        for (int d = 1; d < depth; ++d) {
+            jobs.RunAfter(links[c * depth + d - 1], [&executed]() { executed++; },
+                          d + 1 == depth ? &done : &links[c * depth + d]);
+        }
+    }
+    jobs.Wait(done);
+    for (auto& link : links) jobs.Wait(link);
+    return executed.load() == chains * depth;
+}
+
+// Fixed amount of floating point work per element
+static double MeasureParallelForMs(JobSystem& jobs, std::vector<float>& data) {
+    auto start = Clock::now();
+    jobs.ParallelFor(data.size(), [&data](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            float x = data[i];
+            for (int k = 0; k < 32; ++k) x = std::sqrt(x * x + 1.0f) * 0.5f;
+            data[i] = x;
+        }
+    }, 1024);
+    return ElapsedMs(start);
+}
+
+int main(int argc, char** argv) {
+    int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int maxThreads = argc > 1 ? std::max(1, std::atoi(argv[1])) : hardware;
+
+    const int jobCount = 200000;
+    std::vector<float> data(4 * 1024 * 1024, 1.0f);
+
+    std::cout << "Titan job system benchmark (" << hardware << " hardware threads)\n\n";
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(16) << "ns/empty job"
+              << std::setw(18) << "ParallelFor ms"
+              << std::setw(10) << "speedup"
+              << std::setw(10) << "stolen"
+              << "stress\n";
+
+    double baselineMs = 0.0;
+    bool allPassed = true;
+
+    for (int threads = 1; threads <= maxThreads; ++threads) {
+        JobSystem jobs(threads - 1);
+
+        // Warm up the workers before timing
+        MeasureJobOverheadNs(jobs, 1000);
+
+        double overheadNs = MeasureJobOverheadNs(jobs, jobCount);
+
+        double bestMs = 1e30;
+        for (int run = 0; run < 3; ++run) {
+            bestMs = std::min(bestMs, MeasureParallelForMs(jobs, data));
+        }
+        if (threads == 1) baselineMs = bestMs;
+
+        bool passed = StressDependencies(jobs, 64, 64);
+        allPassed = allPassed && passed;
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(16) << std::fixed << std::setprecision(1) << overheadNs
+                  << std::setw(18) << std::setprecision(2) << bestMs
+                  << std::setw(10) << std::setprecision(2) << baselineMs / bestMs
+                  << std::setw(10) << jobs.GetStolenJobCount()
+                  << (passed ? "ok" : "FAILED") << "\n";
+    }
+
+    return allPassed ? 0 : 1;
+}
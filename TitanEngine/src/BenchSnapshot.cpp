@@ -0,0 +1,100 @@
+// World snapshot benchmark.
+// Times full and delta Capture/Restore of a world of soldiers and projectiles,
+// the way a round reset or a rollback would use them.
+//
+// usage: TitanSnapshotBench [entities] [iterations]
+
+#include "../include/Snapshot.hpp"
+#include "../include/Weapons.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace Titan;
+
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static void Report(const char* label, std::vector<double>& samples, size_t copiedBytes) {
+    std::sort(samples.begin(), samples.end());
+    std::cout << std::left << std::setw(22) << label
+              << std::setw(12) << std::fixed << std::setprecision(1) << samples[samples.size() / 2]
+              << std::setw(12) << samples[samples.size() * 99 / 100]
+              << copiedBytes / 1024 << " KiB\n";
+}
+
+int main(int argc, char** argv) {
+    int entityCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5000;
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 200;
+
+    EntityManager world;
+    std::vector<EntityID> ids;
+    for (int i = 0; i < entityCount; ++i) {
+        EntityID id = world.CreateEntity(i % 10 == 0 ? "Soldier" : "Projectile");
+        world.AddComponent<Transform>(id, glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        world.AddComponent<RigidBody>(id);
+        if (i % 10 == 0) {
+            world.AddComponent<PlayerController>(id);
+            world.AddComponent<WeaponComponent>(id);
+        }
+        ids.push_back(id);
+    }
+
+    WorldSnapshot snapshot;
+    std::vector<double> fullCapture, deltaCapture, deltaRestore, fullRestore;
+    size_t copied[4] = {};
+
+    for (int i = 0; i < iterations; ++i) {
+        snapshot.Reset();
+        auto start = Clock::now();
+        snapshot.Capture(world);
+        fullCapture.push_back(ElapsedUs(start));
+        copied[0] = snapshot.GetStats().copiedBytes;
+    }
+    std::cout << "Titan snapshot benchmark: " << entityCount << " entities, "
+              << snapshot.GetStats().bufferBytes / 1024 << " KiB snapshot\n\n";
+
+    for (int i = 0; i < iterations; ++i) {
+        // A tick's worth of movement touches every Transform
+        world.Each<Transform>([](EntityID, Transform& transform) { transform.position.y += 0.01f; });
+        auto start = Clock::now();
+        snapshot.Capture(world);
+        deltaCapture.push_back(ElapsedUs(start));
+        copied[1] = snapshot.GetStats().copiedBytes;
+    }
+
+    for (int i = 0; i < iterations; ++i) {
+        world.GetComponent<Transform>(ids[i % ids.size()])->position.z += 1.0f;
+        auto start = Clock::now();
+        snapshot.Restore(world);
+        deltaRestore.push_back(ElapsedUs(start));
+        copied[2] = snapshot.GetStats().copiedBytes;
+    }
+
+    for (int i = 0; i < iterations; ++i) {
+        // Round reset after spawns and deaths
+        EntityID spawned = world.CreateEntity("Projectile");
+        world.AddComponent<Transform>(spawned);
+        world.DestroyEntity(ids[(i * 7) % ids.size()]);
+        auto start = Clock::now();
+        snapshot.Restore(world);
+        fullRestore.push_back(ElapsedUs(start));
+        copied[3] = snapshot.GetStats().copiedBytes;
+    }
+
+    std::cout << std::left << std::setw(22) << "operation"
+              << std::setw(12) << "median us"
+              << std::setw(12) << "p99 us"
+              << "copied\n";
+    Report("full capture", fullCapture, copied[0]);
+    Report("delta capture", deltaCapture, copied[1]);
+    Report("delta restore", deltaRestore, copied[2]);
+    Report("full restore", fullRestore, copied[3]);
+    return 0;
+}
@@ -0,0 +1,186 @@
+// Independent world benchmark.
+// Simulates headless bot matches, each in its own EntityManager and physics
+// system, spread over 1 to N threads, and reports matches/second scaling.
+// Every match is seeded by its index, so results must not depend on the
+// thread count.
+//
+// usage: TitanWorldBench [maxThreads] [matches]
+
+#include "../include/Jobs.hpp"
+#include "../include/Physics.hpp"
+#include "../include/Weapons.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Titan;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr int BOTS_PER_MATCH = 10;
+static constexpr int TICK_RATE = 64;
+static constexpr int MATCH_SECONDS = 60;
+static constexpr float ARENA_HALF_SIZE = 40.0f;
+static constexpr float HIT_RADIUS = 1.0f;
+static constexpr float PROJECTILE_SPEED = 30.0f;
+
+struct MatchResult {
+    uint64_t shots{0};
+    uint64_t kills{0};
+
+    bool operator==(const MatchResult& other) const { return shots == other.shots && kills == other.kills; }
+};
+
+static double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// One deathmatch between bots that wander the arena and fire ballistic
+// projectiles at random. Nothing is shared with any other match.
+static MatchResult RunMatch(uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+    EntityManager world;
+    SimplePhysicsSystem physics;
+    physics.SetWorld(&world, nullptr);
+
+    WeaponStats rifle;
+    rifle.damage = 34.0f;
+    rifle.fireRate = 8.0f;
+    rifle.type = WeaponType::Rifle;
+
+    for (int i = 0; i < BOTS_PER_MATCH; ++i) {
+        EntityID bot = world.CreateEntity();
+        world.AddComponent<Transform>(bot, glm::vec3(unit(rng) * ARENA_HALF_SIZE, 1.0f, unit(rng) * ARENA_HALF_SIZE));
+        RigidBody& body = world.AddComponent<RigidBody>(bot);
+        body.useGravity = false;
+        body.velocity = glm::vec3(unit(rng) * 5.0f, 0.0f, unit(rng) * 5.0f);
+        world.AddComponent<PlayerController>(bot).team = static_cast<uint32_t>(i % 2);
+        world.AddComponent<WeaponComponent>(bot, rifle);
+    }
+
+    MatchResult result;
+    std::vector<std::pair<EntityID, glm::vec3>> targets;
+    const float dt = 1.0f / TICK_RATE;
+
+    for (int tick = 0; tick < TICK_RATE * MATCH_SECONDS; ++tick) {
+        physics.Update(dt);
+        EntityCommandBuffer& commands = world.GetCommandBuffer();
+
+        // Bots: bounce off the arena walls, respawn, reload and fire
+        targets.clear();
+        auto bots = world.GetView<Transform, RigidBody, PlayerController, WeaponComponent>();
+        bots.Each([&](EntityID id, Transform& transform, RigidBody& body,
+                      PlayerController& player, WeaponComponent& weapon) {
+            for (int axis : { 0, 2 }) {
+                if (std::abs(transform.position[axis]) > ARENA_HALF_SIZE) body.velocity[axis] = -body.velocity[axis];
+            }
+            if (player.isDead) {
+                player.Respawn();
+                return;
+            }
+            targets.emplace_back(id, transform.position);
+
+            weapon.Update(dt);
+            if (weapon.ammoInMag == 0) {
+                if (weapon.totalAmmo == 0) weapon.totalAmmo = rifle.magSize * 4;  // Resupply
+                weapon.Reload();
+            }
+            if (!weapon.CanShoot() || chance(rng) > 0.1f) return;
+            weapon.Shoot();
+            result.shots++;
+
+            // Spawned outside the shooter's own hit radius
+            float aim = unit(rng) * 3.14159f;
+            glm::vec3 direction(std::cos(aim), 0.0f, std::sin(aim));
+            EntityID projectile = commands.CreateEntity();
+            commands.AddComponent<Transform>(projectile, transform.position + direction * (2.0f * HIT_RADIUS));
+            RigidBody shot;
+            shot.velocity = direction * PROJECTILE_SPEED + glm::vec3(0.0f, 4.0f, 0.0f);
+            commands.AddComponent<RigidBody>(projectile, shot);
+        });
+
+        // Projectiles: hit the first bot in range or vanish into the floor
+        world.Each<Transform, RigidBody>([&](EntityID id, Transform& transform, RigidBody& body) {
+            if (!body.useGravity) return;
+            for (const auto& [bot, position] : targets) {
+                glm::vec3 offset = position - transform.position;
+                if (offset.x * offset.x + offset.y * offset.y + offset.z * offset.z > HIT_RADIUS * HIT_RADIUS) continue;
+                PlayerController* player = world.GetComponent<PlayerController>(bot);
+                player->TakeDamage(rifle.damage);
+                if (player->isDead) result.kills++;
+                commands.DestroyEntity(id);
+                return;
+            }
+            if (transform.position.y < 0.0f) commands.DestroyEntity(id);
+        });
+
+        world.FlushCommands();
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int maxThreads = argc > 1 ? std::max(1, std::atoi(argv[1])) : hardware;
+    int matchCount = argc > 2 ? std::max(1, std::atoi(argv[2])) : 4 * maxThreads;
+
+    std::cout << "Titan world benchmark: " << matchCount << " matches of " << MATCH_SECONDS << " s at "
+              << TICK_RATE << " Hz, " << BOTS_PER_MATCH << " bots each (" << hardware << " hardware threads)\n\n";
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(14) << "matches/s"
+              << std::setw(16) << "ticks/s"
+              << std::setw(10) << "speedup"
+              << std::setw(12) << "efficiency"
+              << "results\n";
+
+    std::vector<MatchResult> reference;
+    double baselineRate = 0.0;
+    bool allMatched = true;
+
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        JobSystem jobs(threads - 1);
+        std::vector<MatchResult> results(matchCount);
+
+        // One match per job; each world runs start to finish on whichever thread picks it up
+        auto start = Clock::now();
+        jobs.ParallelFor(results.size(), [&results](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) results[i] = RunMatch(static_cast<uint32_t>(i));
+        });
+        double seconds = ElapsedMs(start) / 1000.0;
+
+        double rate = matchCount / seconds;
+        if (reference.empty()) {
+            reference = results;
+            baselineRate = rate;
+        }
+        bool matched = results == reference;
+        allMatched = allMatched && matched;
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(14) << std::fixed << std::setprecision(2) << rate
+                  << std::setw(16) << std::setprecision(0) << rate * TICK_RATE * MATCH_SECONDS
+                  << std::setw(10) << std::setprecision(2) << rate / baselineRate
+                  << std::setw(12) << std::setprecision(2) << rate / baselineRate / threads
+                  << (matched ? "ok" : "DIFFER") << "\n";
+    }
+
+    uint64_t shots = 0, kills = 0;
+    for (const MatchResult& match : reference) {
+        shots += match.shots;
+        kills += match.kills;
+    }
+    std::cout << "\n" << shots << " shots, " << kills << " kills across " << matchCount << " matches\n";
+    return allMatched ? 0 : 1;
+}
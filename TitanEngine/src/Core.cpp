@@ -2,9 +2,57 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/euler_angles.hpp>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
 
 namespace Titan {
 
+// ============================================================================
+// SystemAccess Implementation
+// ============================================================================
+
+SystemAccess& SystemAccess::ReadResource(const std::string& name) {
+    readResources.push_back(name);
+    return *this;
+}
+
+SystemAccess& SystemAccess::WriteResource(const std::string& name) {
+    writeResources.push_back(name);
+    return *this;
+}
+
+SystemAccess& SystemAccess::Exclusive() {
+    exclusive = true;
+    return *this;
+}
+
+SystemAccess& SystemAccess::MainThreadOnly() {
+    mainThread = true;
+    return *this;
+}
+
+bool SystemAccess::ConflictsWith(const SystemAccess& other) const {
+    if (exclusive || other.exclusive) return true;
+
+    auto overlaps = [](const auto& a, const auto& b) {
+        for (const auto& x : a) {
+            if (std::find(b.begin(), b.end(), x) != b.end()) return true;
+        }
+        return false;
+    };
+
+    // Write/write and read/write overlaps race; read/read does not
+    return overlaps(writeComponents, other.writeComponents) ||
+           overlaps(writeComponents, other.readComponents) ||
+           overlaps(readComponents, other.writeComponents) ||
+           overlaps(writeResources, other.writeResources) ||
+           overlaps(writeResources, other.readResources) ||
+           overlaps(readResources, other.writeResources);
+}
+
 // ============================================================================
 // Transform Implementation
 // ============================================================================
@@ -44,6 +92,17 @@ glm::vec3 Transform::GetUp() const {
     return glm::vec3(0.0f, 1.0f, 0.0f);
 }
 
+Transform Transform::Interpolate(const Transform& previous, const Transform& current, float alpha) {
+    Transform result(current);
+    result.position = glm::mix(previous.position, current.position, alpha);
+    result.scale = glm::mix(previous.scale, current.scale, alpha);
+    for (int i = 0; i < 3; ++i) {
+        float delta = std::remainder(current.rotation[i] - previous.rotation[i], 6.28318530718f);
+        result.rotation[i] = previous.rotation[i] + delta * alpha;
+    }
+    return result;
+}
+
 // ============================================================================
 // RigidBody Implementation
 // ============================================================================
@@ -74,28 +133,737 @@ void AudioSource::SetVolume(float v) {
     volume = glm::clamp(v, 0.0f, 1.0f);
 }
 
+// ============================================================================
+// ComponentRegistry Implementation
+// ============================================================================
+
+namespace {
+
+struct RegistryState {
+    std::mutex mutex;
+    std::unordered_map<ComponentID, uint32_t> indices;
+};
+
+RegistryState& GetRegistryState() {
+    static RegistryState state;
+    return state;
+}
+
+} // namespace
+
+uint32_t ComponentRegistry::GetIndex(ComponentID id) {
+    RegistryState& state = GetRegistryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.indices.find(id);
+    if (it != state.indices.end()) return it->second;
+
+    if (state.indices.size() >= MAX_COMPONENT_TYPES) {
+        throw std::runtime_error("Too many component types; raise MAX_COMPONENT_TYPES");
+    }
+    uint32_t index = static_cast<uint32_t>(state.indices.size());
+    state.indices.emplace(id, index);
+    return index;
+}
+
+size_t ComponentRegistry::GetCount() {
+    RegistryState& state = GetRegistryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.indices.size();
+}
+
+// ============================================================================
+// ChunkPool Implementation
+// ============================================================================
+
+ChunkPool::~ChunkPool() {
+    // Archetypes return their chunks first; anything still in use is theirs to leak
+    Trim();
+}
+
+uint8_t* ChunkPool::Allocate() {
+    stats.blocksInUse++;
+    if (freeHead) {
+        uint8_t* block = freeHead;
+        std::memcpy(&freeHead, block, sizeof(uint8_t*));
+        stats.blocksFree--;
+        stats.reuses++;
+        return block;
+    }
+
+    stats.systemAllocations++;
+    return static_cast<uint8_t*>(::operator new(BLOCK_SIZE, std::align_val_t{BLOCK_ALIGNMENT}));
+}
+
+void ChunkPool::Release(uint8_t* block) {
+    std::memcpy(block, &freeHead, sizeof(uint8_t*));
+    freeHead = block;
+    stats.blocksInUse--;
+    stats.blocksFree++;
+    stats.releases++;
+}
+
+void ChunkPool::Trim() {
+    while (freeHead) {
+        uint8_t* block = freeHead;
+        std::memcpy(&freeHead, block, sizeof(uint8_t*));
+        ::operator delete(block, std::align_val_t{BLOCK_ALIGNMENT});
+    }
+    stats.blocksFree = 0;
+}
+
+// ============================================================================
+// Archetype Implementation
+// ============================================================================
+
+Archetype::Archetype(std::vector<ComponentTypeInfo> componentTypes, ChunkPool* chunkPool,
+                     const std::atomic<uint32_t>* changeVersion)
+    : types(std::move(componentTypes)), versionClock(changeVersion) {
+    std::sort(types.begin(), types.end(),
+              [](const ComponentTypeInfo& a, const ComponentTypeInfo& b) { return a.id < b.id; });
+
+    signature.reserve(types.size());
+    columnByIndex.fill(-1);
+    size_t rowBytes = sizeof(EntityID);
+    for (size_t c = 0; c < types.size(); ++c) {
+        signature.push_back(types[c].id);
+        mask.set(types[c].index);
+        columnByIndex[types[c].index] = static_cast<int16_t>(c);
+        rowBytes += types[c].size;
+    }
+
+    // Lay out columns for a given capacity; returns the bytes needed
+    auto layout = [this](uint32_t capacity) {
+        columnOffsets.clear();
+        size_t offset = sizeof(EntityID) * capacity;
+        for (const auto& type : types) {
+            offset = (offset + type.alignment - 1) & ~(type.alignment - 1);
+            columnOffsets.push_back(offset);
+            offset += type.size * capacity;
+        }
+        return offset;
+    };
+
+    chunkCapacity = static_cast<uint32_t>(std::max<size_t>(1, CHUNK_SIZE / rowBytes));
+    while (chunkCapacity > 1 && layout(chunkCapacity) > CHUNK_SIZE) {
+        --chunkCapacity;
+    }
+    chunkBytes = std::max(CHUNK_SIZE, layout(chunkCapacity));
+
+    // A single row wider than a chunk cannot use pool blocks
+    if (chunkBytes == CHUNK_SIZE) pool = chunkPool;
+}
+
+Archetype::~Archetype() {
+    DestroyAll();
+    for (auto& chunk : chunks) {
+        FreeChunk(chunk.data);
+    }
+}
+
+uint8_t* Archetype::AllocateChunk() {
+    if (pool) return pool->Allocate();
+    return static_cast<uint8_t*>(::operator new(chunkBytes, std::align_val_t{CHUNK_ALIGNMENT}));
+}
+
+void Archetype::FreeChunk(uint8_t* data) {
+    if (pool) {
+        pool->Release(data);
+    } else {
+        ::operator delete(data, std::align_val_t{CHUNK_ALIGNMENT});
+    }
+}
+
+int Archetype::FindColumn(ComponentID id) const {
+    auto it = std::lower_bound(signature.begin(), signature.end(), id);
+    if (it == signature.end() || *it != id) return -1;
+    return static_cast<int>(it - signature.begin());
+}
+
+void* Archetype::GetComponent(uint32_t row, int column) const {
+    const Chunk& chunk = chunks[row / chunkCapacity];
+    return static_cast<uint8_t*>(GetColumn(chunk, column)) + types[column].size * (row % chunkCapacity);
+}
+
+EntityID Archetype::GetEntity(uint32_t row) const {
+    return GetEntities(chunks[row / chunkCapacity])[row % chunkCapacity];
+}
+
+uint32_t Archetype::AllocateRow(EntityID id) {
+    uint32_t row = entityCount;
+    size_t chunkIndex = row / chunkCapacity;
+    if (chunkIndex == chunks.size()) {
+        Chunk chunk;
+        chunk.data = AllocateChunk();
+        chunks.push_back(chunk);
+        changedVersions.resize(chunks.size() * types.size(), 0);
+        addedVersions.resize(chunks.size() * types.size(), 0);
+    }
+
+    Chunk& chunk = chunks[chunkIndex];
+    GetEntities(chunk)[chunk.count++] = id;
+    ++entityCount;
+    return row;
+}
+
+EntityID Archetype::RemoveRow(uint32_t row, bool destroyComponents) {
+    uint32_t last = entityCount - 1;
+
+    if (destroyComponents) {
+        for (size_t c = 0; c < types.size(); ++c) {
+            types[c].destroy(GetComponent(row, static_cast<int>(c)));
+        }
+    }
+
+    EntityID moved = invalid_entity::value;
+    if (row != last) {
+        size_t rowChunk = row / chunkCapacity;
+        size_t lastChunk = last / chunkCapacity;
+        for (size_t c = 0; c < types.size(); ++c) {
+            void* src = GetComponent(last, static_cast<int>(c));
+            types[c].moveConstruct(GetComponent(row, static_cast<int>(c)), src);
+            types[c].destroy(src);
+            if (rowChunk != lastChunk) {
+                MergeVersions(rowChunk, *this, lastChunk, static_cast<int>(c), static_cast<int>(c));
+            }
+        }
+        moved = GetEntity(last);
+        GetEntities(chunks[row / chunkCapacity])[row % chunkCapacity] = moved;
+    }
+
+    --chunks[last / chunkCapacity].count;
+    --entityCount;
+
+    // Keep at most one trailing empty chunk so a count hovering around a chunk
+    // boundary does not allocate and free on every spawn
+    size_t usedChunks = (entityCount + chunkCapacity - 1) / chunkCapacity;
+    while (chunks.size() > usedChunks + 1) {
+        FreeChunk(chunks.back().data);
+        chunks.pop_back();
+        changedVersions.resize(chunks.size() * types.size());
+        addedVersions.resize(chunks.size() * types.size());
+    }
+    return moved;
+}
+
+void Archetype::ResizeRows(uint32_t rows) {
+    size_t usedChunks = (rows + chunkCapacity - 1) / chunkCapacity;
+    while (chunks.size() > usedChunks) {
+        FreeChunk(chunks.back().data);
+        chunks.pop_back();
+    }
+    while (chunks.size() < usedChunks) {
+        Chunk chunk;
+        chunk.data = AllocateChunk();
+        chunks.push_back(chunk);
+    }
+
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        chunks[c].count = static_cast<uint32_t>(std::min<size_t>(chunkCapacity, rows - c * chunkCapacity));
+    }
+    entityCount = rows;
+
+    uint32_t version = CurrentVersion();
+    changedVersions.assign(chunks.size() * types.size(), version);
+    addedVersions.assign(chunks.size() * types.size(), version);
+}
+
+void Archetype::MarkRowAdded(uint32_t row, int column) {
+    size_t index = (row / chunkCapacity) * types.size() + column;
+    changedVersions[index] = addedVersions[index] = CurrentVersion();
+}
+
+// A row moved between chunks keeps its change history: the destination chunk
+// reports at least what the source chunk did
+void Archetype::MergeVersions(size_t targetChunk, const Archetype& source, size_t sourceChunk,
+                              int sourceColumn, int targetColumn) {
+    size_t target = targetChunk * types.size() + targetColumn;
+    size_t from = sourceChunk * source.types.size() + sourceColumn;
+    changedVersions[target] = std::max(changedVersions[target], source.changedVersions[from]);
+    addedVersions[target] = std::max(addedVersions[target], source.addedVersions[from]);
+}
+
+void Archetype::DestroyAll() {
+    for (auto& chunk : chunks) {
+        for (size_t c = 0; c < types.size(); ++c) {
+            uint8_t* column = static_cast<uint8_t*>(GetColumn(chunk, static_cast<int>(c)));
+            for (uint32_t i = 0; i < chunk.count; ++i) {
+                types[c].destroy(column + types[c].size * i);
+            }
+        }
+        chunk.count = 0;
+    }
+    entityCount = 0;
+}
+
+// ============================================================================
+// QueryCache Implementation
+// ============================================================================
+
+bool QueryCache::TryAdd(Archetype* archetype) {
+    if ((archetype->GetMask() & mask) != mask) return false;
+
+    Match match;
+    match.archetype = archetype;
+    match.columns.reserve(components.size());
+    for (uint32_t index : components) {
+        match.columns.push_back(archetype->FindColumnByIndex(index));
+    }
+    matches.push_back(std::move(match));
+    return true;
+}
+
+// ============================================================================
+// Entity Implementation
+// ============================================================================
+
+bool Entity::IsValid() const {
+    return manager && manager->IsAlive(id);
+}
+
+const std::string& Entity::GetName() const {
+    return manager->GetName(id);
+}
+
+void Entity::SetName(const std::string& newName) {
+    manager->SetName(id, newName);
+}
+
+bool Entity::IsActive() const {
+    return manager && manager->IsActive(id);
+}
+
+void Entity::SetActive(bool state) {
+    manager->SetActive(id, state);
+}
+
+// ============================================================================
+// EntityCommandBuffer Implementation
+// ============================================================================
+
+EntityCommandBuffer::~EntityCommandBuffer() {
+    Clear();
+    for (auto& block : blocks) {
+        ::operator delete(block.data, std::align_val_t(Archetype::CHUNK_ALIGNMENT));
+    }
+}
+
+EntityID EntityCommandBuffer::CreateEntity(const std::string& name) {
+    if (pendingCount > ENTITY_INDEX_MASK) {
+        throw std::runtime_error("Too many pending entities in command buffer");
+    }
+
+    Command command;
+    command.type = CommandType::CreateEntity;
+    command.entity = ENTITY_PENDING_BIT | pendingCount++;
+    command.nameIndex = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    commands.push_back(command);
+    return command.entity;
+}
+
+void EntityCommandBuffer::DestroyEntity(EntityID id) {
+    Command command;
+    command.type = CommandType::DestroyEntity;
+    command.entity = id;
+    commands.push_back(command);
+}
+
+void EntityCommandBuffer::Apply(EntityManager& manager) {
+    createdEntities.assign(pendingCount, invalid_entity::value);
+
+    try {
+        for (auto& command : commands) {
+            if (command.type == CommandType::CreateEntity) {
+                createdEntities[command.entity & ~ENTITY_PENDING_BIT] = manager.CreateEntity(names[command.nameIndex]);
+                continue;
+            }
+
+            EntityID target = Resolve(command.entity);
+            switch (command.type) {
+            case CommandType::DestroyEntity:
+                manager.DestroyEntity(target);
+                break;
+
+            case CommandType::AddComponent:
+                if (manager.IsAlive(target)) {
+                    bool replaced = false;
+                    void* storage = manager.AddComponentStorage(target, command.info, replaced);
+                    if (replaced) command.info.destroy(storage);
+                    command.info.moveConstruct(storage, command.payload);
+                }
+                command.info.destroy(command.payload);
+                command.payload = nullptr;
+                break;
+
+            case CommandType::RemoveComponent:
+                manager.RemoveComponentStorage(target, command.info.index);
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+    catch (...) {
+        Clear();
+        throw;
+    }
+
+    Clear();
+}
+
+void EntityCommandBuffer::Clear() {
+    // Values recorded but never applied still need their destructors run
+    for (auto& command : commands) {
+        if (command.payload) command.info.destroy(command.payload);
+    }
+    commands.clear();
+    names.clear();
+    createdEntities.clear();
+    pendingCount = 0;
+
+    // Keep the blocks for the next frame
+    for (auto& block : blocks) block.used = 0;
+    currentBlock = 0;
+}
+
+void* EntityCommandBuffer::AllocatePayload(size_t size, size_t alignment) {
+    while (currentBlock < blocks.size()) {
+        PayloadBlock& block = blocks[currentBlock];
+        size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= block.size) {
+            block.used = offset + size;
+            return block.data + offset;
+        }
+        ++currentBlock;
+    }
+
+    // Oversized values get a block of their own
+    PayloadBlock block;
+    block.size = std::max(PAYLOAD_BLOCK_SIZE, size);
+    block.data = static_cast<uint8_t*>(::operator new(block.size, std::align_val_t(Archetype::CHUNK_ALIGNMENT)));
+    block.used = size;
+    blocks.push_back(block);
+    currentBlock = blocks.size() - 1;
+    return block.data;
+}
+
+EntityID EntityCommandBuffer::Resolve(EntityID id) const {
+    if (!IsPendingEntity(id)) return id;
+
+    uint32_t index = id & ~ENTITY_PENDING_BIT;
+    if (index >= createdEntities.size()) {
+        throw std::runtime_error("Pending entity does not belong to this command buffer");
+    }
+    return createdEntities[index];
+}
+
 // ============================================================================
 // EntityManager Implementation
 // ============================================================================
 
+// Each thread remembers the last manager it recorded into, keyed by serial
+// rather than address so a new manager at a recycled address is not confused
+// with a destroyed one.
+static std::atomic<uint64_t> s_nextManagerSerial{1};
+
+struct ThreadCommandBufferCache {
+    uint64_t managerSerial{0};
+    EntityCommandBuffer* buffer{nullptr};
+};
+
+static thread_local ThreadCommandBufferCache t_commandBufferCache;
+
+EntityManager::EntityManager()
+    : serial(s_nextManagerSerial.fetch_add(1)) {
+    Clear();
+}
+
+EntityManager::~EntityManager() = default;
+
 EntityID EntityManager::CreateEntity(const std::string& name) {
-    auto entity = std::make_shared<Entity>(nextID, name);
-    entities[nextID] = entity;
-    return nextID++;
+    uint32_t index = freeHead;
+    if (index != 0) {
+        freeHead = slots[index].nextFree;
+        if (freeHead == 0) freeTail = 0;
+    } else {
+        if (slots.size() > ENTITY_INDEX_MASK) {
+            throw std::runtime_error("Entity limit reached");
+        }
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    EntityRecord& record = slots[index];
+    EntityID id = MakeEntityID(index, record.generation);
+    ++structuralVersion;
+    record.name = name;
+    record.active = true;
+    record.nextFree = 0;
+    record.archetype = emptyArchetype;
+    record.row = emptyArchetype->AllocateRow(id);
+    ++entityCount;
+    return id;
 }
 
 void EntityManager::DestroyEntity(EntityID id) {
-    entities.erase(id);
+    EntityRecord* record = FindRecord(id);
+    if (!record) return;
+
+    UpdateMovedRow(record->archetype->RemoveRow(record->row, true), record->row);
+    ++structuralVersion;
+
+    // Retire the handle and append the slot to the free list
+    uint32_t index = GetEntityIndex(id);
+    record->archetype = nullptr;
+    record->generation = (record->generation + 1) & ENTITY_GENERATION_MASK;
+    record->nextFree = 0;
+    if (freeTail != 0) {
+        slots[freeTail].nextFree = index;
+    } else {
+        freeHead = index;
+    }
+    freeTail = index;
+    --entityCount;
 }
 
-std::shared_ptr<Entity> EntityManager::GetEntity(EntityID id) {
-    auto it = entities.find(id);
-    return (it != entities.end()) ? it->second : nullptr;
+Entity EntityManager::GetEntity(EntityID id) {
+    return IsAlive(id) ? Entity(this, id) : Entity();
 }
 
 void EntityManager::Clear() {
-    entities.clear();
-    nextID = 1;
+    ++structuralVersion;
+
+    // Keep the slots so handles from before stay stale: retire every live
+    // one as DestroyEntity does and chain all slots into the free list
+    if (slots.empty()) slots.emplace_back();
+    freeHead = 0;
+    freeTail = 0;
+    for (uint32_t index = 1; index < slots.size(); ++index) {
+        EntityRecord& record = slots[index];
+        if (record.archetype) {
+            record.archetype = nullptr;
+            record.generation = (record.generation + 1) & ENTITY_GENERATION_MASK;
+            record.name.clear();
+        }
+        record.nextFree = 0;
+        if (freeTail != 0) {
+            slots[freeTail].nextFree = index;
+        } else {
+            freeHead = index;
+        }
+        freeTail = index;
+    }
+    entityCount = 0;
+
+    // Views may still reference their caches, so keep them and drop the matches
+    for (auto& [components, cache] : queryCaches) {
+        cache->matches.clear();
+    }
+    archetypeLookup.clear();
+    archetypes.clear();
+    emptyArchetype = GetOrCreateArchetype({});
+
+    // Pending commands refer to the old world
+    for (auto& buffer : commandBuffers) {
+        buffer->Clear();
+    }
+}
+
+void EntityManager::ReserveEntities(size_t count) {
+    slots.reserve(count + 1);  // + reserved slot 0
+}
+
+EntityCommandBuffer& EntityManager::GetCommandBuffer() {
+    if (t_commandBufferCache.managerSerial == serial) {
+        return *t_commandBufferCache.buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(commandBufferMutex);
+    EntityCommandBuffer*& buffer = threadCommandBuffers[std::this_thread::get_id()];
+    if (!buffer) {
+        commandBuffers.push_back(std::make_unique<EntityCommandBuffer>());
+        buffer = commandBuffers.back().get();
+    }
+
+    t_commandBufferCache.managerSerial = serial;
+    t_commandBufferCache.buffer = buffer;
+    return *buffer;
+}
+
+void EntityManager::FlushCommands() {
+    std::lock_guard<std::mutex> lock(commandBufferMutex);
+    for (auto& buffer : commandBuffers) {
+        if (!buffer->IsEmpty()) buffer->Apply(*this);
+    }
+}
+
+const std::string& EntityManager::GetName(EntityID id) const {
+    static const std::string empty;
+    const EntityRecord* record = FindRecord(id);
+    return record ? record->name : empty;
+}
+
+void EntityManager::SetName(EntityID id, const std::string& name) {
+    if (EntityRecord* record = FindRecord(id)) {
+        record->name = name;
+        ++structuralVersion;
+    }
+}
+
+bool EntityManager::IsActive(EntityID id) const {
+    const EntityRecord* record = FindRecord(id);
+    return record && record->active;
+}
+
+void EntityManager::SetActive(EntityID id, bool active) {
+    if (EntityRecord* record = FindRecord(id)) {
+        record->active = active;
+        ++structuralVersion;
+    }
+}
+
+Archetype* EntityManager::GetOrCreateArchetype(std::vector<ComponentTypeInfo> types) {
+    ComponentMask mask;
+    for (const auto& type : types) mask.set(type.index);
+
+    auto it = archetypeLookup.find(mask);
+    if (it != archetypeLookup.end()) return it->second;
+
+    archetypes.push_back(std::make_unique<Archetype>(std::move(types), &chunkPool, &changeVersion));
+    Archetype* archetype = archetypes.back().get();
+    archetypeLookup[mask] = archetype;
+
+    // Keep cached views incremental: only the new archetype needs testing
+    for (auto& [components, cache] : queryCaches) {
+        cache->TryAdd(archetype);
+    }
+    return archetype;
+}
+
+const QueryCache* EntityManager::GetQueryCache(std::initializer_list<uint32_t> components) {
+    std::lock_guard<std::mutex> lock(queryCacheMutex);
+    auto it = queryCaches.find(components);
+    if (it != queryCaches.end()) return it->second.get();
+
+    auto cache = std::make_unique<QueryCache>();
+    cache->components.assign(components.begin(), components.end());
+    for (uint32_t index : components) cache->mask.set(index);
+    for (auto& archetype : archetypes) {
+        cache->TryAdd(archetype.get());
+    }
+
+    const QueryCache* result = cache.get();
+    queryCaches.emplace(std::vector<uint32_t>(components), std::move(cache));
+    return result;
+}
+
+void EntityManager::MoveEntity(EntityID id, EntityRecord& record, Archetype* target) {
+    Archetype* source = record.archetype;
+    uint32_t newRow = target->AllocateRow(id);
+    ++structuralVersion;
+
+    // Move shared components across; components missing from the target are destroyed
+    for (size_t c = 0; c < source->types.size(); ++c) {
+        void* src = source->GetComponent(record.row, static_cast<int>(c));
+        int targetColumn = target->FindColumnByIndex(source->types[c].index);
+        if (targetColumn >= 0) {
+            source->types[c].moveConstruct(target->GetComponent(newRow, targetColumn), src);
+            target->MergeVersions(newRow / target->chunkCapacity, *source, record.row / source->chunkCapacity,
+                                  static_cast<int>(c), targetColumn);
+        }
+        source->types[c].destroy(src);
+    }
+
+    UpdateMovedRow(source->RemoveRow(record.row, false), record.row);
+
+    record.archetype = target;
+    record.row = newRow;
+}
+
+void* EntityManager::AddComponentStorage(EntityID id, const ComponentTypeInfo& info, bool& replaced) {
+    EntityRecord* record = FindRecord(id);
+    if (!record) {
+        throw std::runtime_error("AddComponent on an entity that does not exist");
+    }
+
+    Archetype* source = record->archetype;
+    int column = source->FindColumnByIndex(info.index);
+    if (column >= 0) {
+        replaced = true;
+        source->MarkRowChanged(record->row, column);
+        return source->GetComponent(record->row, column);
+    }
+
+    Archetype* target = nullptr;
+    auto edge = source->addEdges.find(info.index);
+    if (edge != source->addEdges.end()) {
+        target = edge->second;
+    } else {
+        std::vector<ComponentTypeInfo> types = source->types;
+        types.push_back(info);
+        target = GetOrCreateArchetype(std::move(types));
+        source->addEdges[info.index] = target;
+        target->removeEdges[info.index] = source;
+    }
+
+    MoveEntity(id, *record, target);
+    replaced = false;
+    column = target->FindColumnByIndex(info.index);
+    target->MarkRowAdded(record->row, column);
+    return target->GetComponent(record->row, column);
+}
+
+void* EntityManager::GetComponentStorage(EntityID id, uint32_t componentIndex) {
+    EntityRecord* record = FindRecord(id);
+    if (!record) return nullptr;
+
+    int column = record->archetype->FindColumnByIndex(componentIndex);
+    if (column < 0) return nullptr;
+    record->archetype->MarkRowChanged(record->row, column);
+    return record->archetype->GetComponent(record->row, column);
+}
+
+const void* EntityManager::ReadComponentStorage(EntityID id, uint32_t componentIndex) const {
+    const EntityRecord* record = FindRecord(id);
+    if (!record) return nullptr;
+
+    int column = record->archetype->FindColumnByIndex(componentIndex);
+    return (column >= 0) ? record->archetype->GetComponent(record->row, column) : nullptr;
+}
+
+uint32_t EntityManager::GetComponentVersion(EntityID id, uint32_t componentIndex) const {
+    const EntityRecord* record = FindRecord(id);
+    if (!record) return 0;
+
+    int column = record->archetype->FindColumnByIndex(componentIndex);
+    if (column < 0) return 0;
+    return record->archetype->GetChangedVersion(record->row / record->archetype->GetChunkCapacity(), column);
+}
+
+void EntityManager::RemoveComponentStorage(EntityID id, uint32_t componentIndex) {
+    EntityRecord* record = FindRecord(id);
+    if (!record) return;
+
+    Archetype* source = record->archetype;
+    if (!source->HasComponentIndex(componentIndex)) return;
+
+    Archetype* target = nullptr;
+    auto edge = source->removeEdges.find(componentIndex);
+    if (edge != source->removeEdges.end()) {
+        target = edge->second;
+    } else {
+        std::vector<ComponentTypeInfo> types;
+        for (const auto& type : source->types) {
+            if (type.index != componentIndex) types.push_back(type);
+        }
+        target = GetOrCreateArchetype(std::move(types));
+        source->removeEdges[componentIndex] = target;
+        target->addEdges[componentIndex] = source;
+    }
+
+    MoveEntity(id, *record, target);
 }
 
 // ============================================================================
@@ -115,8 +883,27 @@ void EventBus::Publish(const Event& event) {
     }
 }
 
+void EventBus::Dispatch() {
+    // Handlers may create channels, so re-read the list each step
+    for (size_t i = 0;; ++i) {
+        IEventChannel* channel = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(channelMutex);
+            if (i >= channels.size()) break;
+            channel = channels[i].get();
+        }
+        channel->Dispatch();
+    }
+}
+
 void EventBus::Clear() {
     subscribers.clear();
+
+    // Channels stay alive since callers may hold references to them
+    std::lock_guard<std::mutex> lock(channelMutex);
+    for (auto& channel : channels) {
+        channel->Clear();
+    }
 }
 
 } // namespace Titan
@@ -8,26 +8,17 @@
 #include "../include/Networking.hpp"
 #include "../include/Gamemodes.hpp"
 #include "../include/Performance.hpp"
+#include "../include/Profiler.hpp"
+#ifdef _WIN32
 #include <windows.h>
+#include <mmsystem.h>
+#endif
 #include <iostream>
 #include <stdexcept>
 #include <chrono>
 
 namespace Titan {
 
-static Engine* g_engine = nullptr;
-
-Engine& GetEngine() {
-    if (!g_engine) {
-        throw std::runtime_error("Engine not initialized!");
-    }
-    return *g_engine;
-}
-
-void SetEngineInstance(Engine* engine) {
-    g_engine = engine;
-}
-
 Engine::~Engine() = default;
 
 // ============================================================================
@@ -36,13 +27,18 @@ Engine::~Engine() = default;
 
 bool Engine::Initialize(const EngineConfig& engineConfig) {
     config = engineConfig;
-    SetEngineInstance(this);
 
     try {
         // Create systems
+        jobSystem = std::make_unique<JobSystem>(config.workerThreads);
+        frameArena = std::make_unique<LinearArena>(1024 * 1024);
         entityManager = std::make_unique<EntityManager>();
+        transformHierarchy = std::make_unique<TransformHierarchy>();
+        transformInterpolator = std::make_unique<TransformInterpolator>();
         eventBus = std::make_unique<EventBus>();
+#ifdef _WIN32
         window = std::make_unique<Win32Window>();
+#endif
         renderer = std::make_unique<GLRenderer>();
         inputSystem = std::make_unique<SimpleInputSystem>();
         scriptingSystem = std::make_unique<LuaScriptingSystem>();
@@ -55,8 +51,21 @@ bool Engine::Initialize(const EngineConfig& engineConfig) {
         cullingSystem = std::make_unique<CullingSystem>();
         performanceMonitor = std::make_unique<PerformanceMonitor>();
 
+        inputSystem->SetEventBus(eventBus.get());
+        gamemode->SetEventBus(eventBus.get());
+
+        // Systems reach their world through these, never through a global,
+        // so any number of engines can run side by side in one process
+        physicsSystem->SetWorld(entityManager.get(), jobSystem.get());
+        scriptingSystem->SetEngine(this);
+        gamemode->SetWorld(entityManager.get());
+
         // Create window (only if not headless)
         if (!config.headless) {
+            if (!window) {
+                std::cerr << "No window backend on this platform; run with config.headless." << std::endl;
+                return false;
+            }
             if (!window->Create(config.appName, config.windowWidth, config.windowHeight)) {
                 std::cerr << "Failed to create window!" << std::endl;
                 return false;
@@ -67,6 +76,27 @@ bool Engine::Initialize(const EngineConfig& engineConfig) {
         // Initialize all systems
         InitializeSystems();
 
+        if (config.tickRate > 0) {
+            fixedTimestep = FixedTimestep(config.tickRate, config.maxTicksPerFrame);
+        }
+        framePacer.SetTargetFPS(config.targetFPS);
+
+        if (!config.telemetryName.empty()) {
+            telemetry = std::make_unique<TelemetryPublisher>();
+            if (!telemetry->Open(config.telemetryName)) {
+                std::cerr << "Warning: Telemetry segment '" << config.telemetryName << "' could not be created." << std::endl;
+                telemetry.reset();
+            }
+        }
+        if (config.hitchRatio > 0.0f) {
+            HitchRecorder::Config hitchConfig;
+            hitchConfig.p95Ratio = config.hitchRatio;
+            hitchRecorder = std::make_unique<HitchRecorder>(hitchConfig);
+            hitchRecorder->Start();
+        }
+
+        Profiler::SetThreadName("Main");
+
         running = true;
         lastFrameTime = std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1e9;
 
@@ -117,29 +147,77 @@ void Engine::InitializeSystems() {
     if (!config.headless) {
         systems.push_back(renderer.get());
     }
+
+    scheduler = std::make_unique<SystemScheduler>(*jobSystem);
+    scheduler->SetSystems(systems);
 }
 
 void Engine::Run() {
+#ifdef _WIN32
+    // 1 ms scheduler granularity keeps the pacer's coarse sleep short
+    timeBeginPeriod(1);
+#endif
+
     while (running && (config.headless || window->IsOpen())) {
-        CalculateDeltaTime();
-        
-        if (!config.headless) {
-            window->Update();
-        }
-        UpdateSystems(deltaTime);
-        
-        if (!config.headless) {
-            RenderFrame();
-        }
+        {
+            TITAN_PROFILE_SCOPE("Frame");
+            CalculateDeltaTime();
+            performanceMonitor->StartFrame();
+            performanceMonitor->RecordFrameTime(frameTime);
+
+            if (!config.headless) {
+                window->Update();
+            }
 
-        // Simple FPS limit
-        if (config.targetFPS > 0) {
-            float targetFrameTime = 1.0f / config.targetFPS;
-            if (deltaTime < targetFrameTime) {
-                float sleepTime = targetFrameTime - deltaTime;
-                Sleep(static_cast<DWORD>(sleepTime * 1000));
+            if (config.tickRate > 0) {
+                uint32_t ticks = fixedTimestep.Advance(frameTime);
+                for (uint32_t tick = 0; tick < ticks; ++tick) {
+                    transformInterpolator->BeginTick(*entityManager);
+                    UpdateSystems(fixedTimestep.GetStep());
+                }
+            } else {
+                UpdateSystems(frameTime);
+            }
+
+            if (!config.headless) {
+                RenderFrame();
+            }
+
+            // Once per frame, however many ticks it ran, while the frame is still open
+            ReleaseFrameScratch();
+            performanceMonitor->RecordEntityCount(static_cast<uint32_t>(entityManager->GetEntityCount()));
+            MemoryTracker::TakeSnapshot(allocationTotals);
+            performanceMonitor->RecordAllocations(allocationTotals);
+            performanceMonitor->EndFrame();
+            if (telemetry) {
+                telemetry->Publish(*performanceMonitor, &networkManager->GetStats(),
+                                   static_cast<uint32_t>(networkManager->GetConnectedPlayers().size()));
             }
         }
+
+        // After the frame zone closes, so a captured window includes it
+        if (hitchRecorder) hitchRecorder->OnFrameEnd(*performanceMonitor);
+
+        // Hold the target frame rate against an absolute schedule
+        TITAN_PROFILE_SCOPE("FramePacer");
+        framePacer.WaitForNextFrame();
+    }
+
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+
+    FramePacer::Stats pacing = framePacer.GetStats();
+    if (pacing.frames > 0) {
+        std::cout << "Frame pacing: " << pacing.frames << " frames, " << pacing.missedFrames
+                  << " missed, error mean " << pacing.meanErrorUs << " us, max " << pacing.maxErrorUs
+                  << " us, stddev " << pacing.stdDevErrorUs << " us" << std::endl;
+    }
+    if (!performanceMonitor->GetSystemNames().empty()) {
+        performanceMonitor->PrintTopSystems(std::cout, 5);
+    }
+    if (allocationTotals.total.allocations > 0) {
+        MemoryTracker::PrintReport(std::cout, 5);
     }
 
     Shutdown();
@@ -147,37 +225,80 @@ void Engine::Run() {
 
 void Engine::CalculateDeltaTime() {
     double currentTime = std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1e9;
-    deltaTime = static_cast<float>(currentTime - lastFrameTime);
-    elapsedTime += deltaTime;
+    frameTime = static_cast<float>(currentTime - lastFrameTime);
+    elapsedTime += frameTime;
     lastFrameTime = currentTime;
+}
 
-    // Cap deltaTime to prevent physics issues
-    if (deltaTime > 0.033f) {  // Cap at ~30 FPS worth of delta
-        deltaTime = 0.033f;
-    }
+void Engine::ReleaseFrameScratch() {
+    // The frame's work is done: report its scratch usage and release it
+    performanceMonitor->RecordScratchUsage(frameArena->GetUsedBytes());
+    frameArena->Reset();
 }
 
 void Engine::UpdateSystems(float dt) {
-    for (auto system : systems) {
-        system->Update(dt);
+    TITAN_PROFILE_SCOPE("UpdateSystems");
+    deltaTime = dt;
+
+    // Deliver events queued since the last frame (input, gameplay, worker threads)
+    {
+        TITAN_PROFILE_SCOPE("DispatchEvents");
+        eventBus->Dispatch();
     }
+
+    // Every system is timed; ticks within one frame add up
+    if (scheduler) {
+        scheduler->Run(dt);
+        for (size_t i = 0; i < scheduler->GetSystemCount(); ++i) {
+            const char* name = scheduler->GetSystem(i)->GetName();
+            performanceMonitor->RecordSystemTime(name, scheduler->GetLastUpdateTime(i));
+            performanceMonitor->RecordSystemCounters(name, scheduler->GetLastCounters(i));
+        }
+    } else {
+        for (auto system : systems) {
+            TITAN_PROFILE_SCOPE(system->GetName());
+            MemoryTagScope tag(system->GetName());
+            CounterSample startCounters, endCounters;
+            bool counting = HardwareCounters::Read(startCounters);
+            auto start = std::chrono::steady_clock::now();
+            system->Update(dt);
+            performanceMonitor->RecordSystemTime(
+                system->GetName(), std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count());
+            if (counting && HardwareCounters::Read(endCounters)) {
+                performanceMonitor->RecordSystemCounters(system->GetName(), endCounters.Since(startCounters));
+            }
+        }
+    }
+
+    // Sync point: structural changes recorded during the update land here
+    {
+        TITAN_PROFILE_SCOPE("FlushCommands");
+        entityManager->FlushCommands();
+    }
+
+    // Entities are where they will be drawn now; resolve attached transforms
+    TITAN_PROFILE_SCOPE("TransformHierarchy");
+    transformHierarchy->Update(*entityManager);
 }
 
 void Engine::RenderFrame() {
+    TITAN_PROFILE_SCOPE("RenderFrame");
+    MemoryTagScope tag("RenderFrame");
     renderer->BeginFrame();
     
-    // Render all entities
-    for (const auto& [entityID, entity] : entityManager->GetAllEntities()) {
-        if (!entity->IsActive()) continue;
+    // Render all entities that have both a transform and a renderable, between
+    // the last two simulation ticks
+    float alpha = GetInterpolationAlpha();
+    entityManager->GetView<const Transform, const Renderable>().Each(
+        [this, alpha](EntityID entityID, const Transform& transform, const Renderable& renderable) {
+            if (!entityManager->IsActive(entityID)) return;
+            Transform drawn = transformInterpolator->Blend(entityID, transform, alpha);
 
-        auto transform = entity->GetComponent<Transform>();
-        auto renderable = entity->GetComponent<Renderable>();
-
-        if (transform && renderable) {
             // This would render the entity
-            // renderer->SubmitMesh(mesh, transform->GetModelMatrix());
-        }
-    }
+            // renderer->SubmitMesh(mesh, drawn.GetModelMatrix());
+            (void)drawn;
+            (void)renderable;
+        });
 
     renderer->EndFrame();
     renderer->Present();
@@ -186,6 +307,10 @@ void Engine::RenderFrame() {
 void Engine::Shutdown() {
     std::cout << "Shutting down engine..." << std::endl;
 
+    scheduler.reset();
+    telemetry.reset();
+    hitchRecorder.reset();
+
     if (audioSystem) audioSystem->Shutdown();
     if (scriptingSystem) scriptingSystem->Shutdown();
     if (physicsSystem) physicsSystem->Shutdown();
@@ -197,12 +322,29 @@ void Engine::Shutdown() {
     if (performanceMonitor) performanceMonitor->Shutdown();
     if (window) window->Destroy();
 
+    transformHierarchy->Clear();
+    transformInterpolator->Clear();
     entityManager->Clear();
     eventBus->Clear();
 
     running = false;
 }
 
+LinearArena& Engine::GetFrameArena() {
+    if (!frameArena) throw std::runtime_error("Frame arena not initialized!");
+    return *frameArena;
+}
+
+TransformHierarchy& Engine::GetTransformHierarchy() {
+    if (!transformHierarchy) throw std::runtime_error("Transform hierarchy not initialized!");
+    return *transformHierarchy;
+}
+
+JobSystem& Engine::GetJobSystem() {
+    if (!jobSystem) throw std::runtime_error("Job system not initialized!");
+    return *jobSystem;
+}
+
 NetworkManager& Engine::GetNetworkManager() {
     if (!networkManager) throw std::runtime_error("Network manager not initialized!");
     return *networkManager;
@@ -238,6 +380,18 @@ PhysicsSystem& Engine::GetPhysicsSystem() {
     return *physicsSystem;
 }
 
+void Engine::CaptureSnapshot(WorldSnapshot& snapshot) {
+    if (!entityManager) throw std::runtime_error("Engine not initialized!");
+    snapshot.Capture(*entityManager);
+    if (gamemode) gamemode->SaveState(snapshot.GetGameState());
+}
+
+void Engine::RestoreSnapshot(WorldSnapshot& snapshot) {
+    if (!entityManager) throw std::runtime_error("Engine not initialized!");
+    snapshot.Restore(*entityManager);
+    if (gamemode && !snapshot.GetGameState().empty()) gamemode->LoadState(snapshot.GetGameState());
+}
+
 AudioSystem& Engine::GetAudioSystem() {
     if (!audioSystem) throw std::runtime_error("Audio system not initialized!");
     return *audioSystem;
@@ -253,9 +407,7 @@ extern "C" {
 
 TITAN_API void* CreateEngine() {
     try {
-        Titan::Engine* engine = new Titan::Engine();
-        Titan::SetEngineInstance(engine);
-        return engine;
+        return new Titan::Engine();
     }
     catch (...) {
         return nullptr;
@@ -264,9 +416,7 @@ TITAN_API void* CreateEngine() {
 
 TITAN_API void DestroyEngine(void* engine) {
     if (engine) {
-        Titan::Engine* e = static_cast<Titan::Engine*>(engine);
-        Titan::SetEngineInstance(nullptr);
-        delete e;
+        delete static_cast<Titan::Engine*>(engine);
     }
 }
 
@@ -331,16 +481,22 @@ TITAN_API void DestroyEntity(void* engine, int entityId) {
     e->GetEntityManager().DestroyEntity(static_cast<Titan::EntityID>(entityId));
 }
 
+// Entity IDs are generational handles; a destroyed entity's ID stays invalid
+// even after its slot is reused.
+TITAN_API bool IsEntityValid(void* engine, int entityId) {
+    if (!engine || entityId <= 0) return false;
+    Titan::Engine* e = static_cast<Titan::Engine*>(engine);
+    if (!e->IsInitialized()) return false;
+    return e->GetEntityManager().IsAlive(static_cast<Titan::EntityID>(entityId));
+}
+
 TITAN_API void SetEntityPosition(void* engine, int entityId, float x, float y, float z) {
     if (!engine) return;
     Titan::Engine* e = static_cast<Titan::Engine*>(engine);
     if (!e->IsInitialized()) return;
-    auto entity = e->GetEntityManager().GetEntity(static_cast<Titan::EntityID>(entityId));
-    if (entity) {
-        auto transform = entity->GetComponent<Titan::Transform>();
-        if (transform) {
-            transform->position = glm::vec3(x, y, z);
-        }
+    auto transform = e->GetEntityManager().GetComponent<Titan::Transform>(static_cast<Titan::EntityID>(entityId));
+    if (transform) {
+        transform->position = glm::vec3(x, y, z);
     }
 }
 
@@ -348,14 +504,11 @@ TITAN_API void GetEntityPosition(void* engine, int entityId, float* x, float* y,
     if (!engine || !x || !y || !z) return;
     Titan::Engine* e = static_cast<Titan::Engine*>(engine);
     if (!e->IsInitialized()) return;
-    auto entity = e->GetEntityManager().GetEntity(static_cast<Titan::EntityID>(entityId));
-    if (entity) {
-        auto transform = entity->GetComponent<Titan::Transform>();
-        if (transform) {
-            *x = transform->position.x;
-            *y = transform->position.y;
-            *z = transform->position.z;
-        }
+    auto transform = e->GetEntityManager().ReadComponent<Titan::Transform>(static_cast<Titan::EntityID>(entityId));
+    if (transform) {
+        *x = transform->position.x;
+        *y = transform->position.y;
+        *z = transform->position.z;
     }
 }
 
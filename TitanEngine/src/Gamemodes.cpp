@@ -1,8 +1,46 @@
 #include "../include/Gamemodes.hpp"
+#include <cstring>
 #include <iostream>
+#include <stdexcept>
 
 namespace Titan {
 
+// Plain values appended to / read back from a gamemode state blob
+template<typename T>
+static void WriteState(std::vector<uint8_t>& out, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "State values must be plain");
+    size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+template<typename T>
+static T ReadState(const std::vector<uint8_t>& in, size_t& offset) {
+    if (offset + sizeof(T) > in.size()) {
+        throw std::runtime_error("Gamemode state is truncated");
+    }
+    T value;
+    std::memcpy(&value, in.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+// ============================================================================
+// Gamemode Implementation
+// ============================================================================
+
+void Gamemode::PublishPlayerDeath(uint32_t playerID, uint32_t killerID) {
+    if (playerDeathChannel) {
+        playerDeathChannel->PublishAsync(PlayerDeathEvent(playerID, killerID));
+    }
+}
+
+void Gamemode::PublishRoundEnded() {
+    if (roundEndedChannel) {
+        roundEndedChannel->PublishAsync(RoundEndedEvent(GetGamemodeType(), GetWinningTeam()));
+    }
+}
+
 // ============================================================================
 // Deathmatch Implementation
 // ============================================================================
@@ -43,6 +81,7 @@ void DeathmatchGamemode::StartRound() {
 void DeathmatchGamemode::EndRound() {
     std::cout << "Deathmatch round ended" << std::endl;
     roundActive = false;
+    PublishRoundEnded();
 }
 
 void DeathmatchGamemode::OnPlayerJoined(uint32_t playerID) {
@@ -60,6 +99,7 @@ void DeathmatchGamemode::OnPlayerDeath(uint32_t playerID, uint32_t killerID) {
         playerScores[killerID]++;
     }
     std::cout << "Player " << playerID << " eliminated by " << killerID << std::endl;
+    PublishPlayerDeath(playerID, killerID);
 }
 
 void DeathmatchGamemode::OnPlayerRespawn(uint32_t playerID) {
@@ -71,6 +111,29 @@ const std::vector<Team>& DeathmatchGamemode::GetTeams() const {
     return empty;
 }
 
+void DeathmatchGamemode::SaveState(std::vector<uint8_t>& out) const {
+    out.clear();
+    WriteState(out, roundActive);
+    WriteState(out, roundTime);
+    WriteState(out, static_cast<uint32_t>(playerScores.size()));
+    for (const auto& [playerID, score] : playerScores) {
+        WriteState(out, playerID);
+        WriteState(out, score);
+    }
+}
+
+void DeathmatchGamemode::LoadState(const std::vector<uint8_t>& in) {
+    size_t offset = 0;
+    roundActive = ReadState<bool>(in, offset);
+    roundTime = ReadState<float>(in, offset);
+    playerScores.clear();
+    uint32_t players = ReadState<uint32_t>(in, offset);
+    for (uint32_t i = 0; i < players; ++i) {
+        uint32_t playerID = ReadState<uint32_t>(in, offset);
+        playerScores[playerID] = ReadState<int32_t>(in, offset);
+    }
+}
+
 // ============================================================================
 // Team Deathmatch Implementation
 // ============================================================================
@@ -126,6 +189,7 @@ void TeamDeathmatchGamemode::StartRound() {
 void TeamDeathmatchGamemode::EndRound() {
     std::cout << "Team Deathmatch round ended" << std::endl;
     roundActive = false;
+    PublishRoundEnded();
 }
 
 void TeamDeathmatchGamemode::OnPlayerJoined(uint32_t playerID) {
@@ -138,6 +202,7 @@ void TeamDeathmatchGamemode::OnPlayerLeft(uint32_t playerID) {
 
 void TeamDeathmatchGamemode::OnPlayerDeath(uint32_t playerID, uint32_t killerID) {
     std::cout << "Player " << playerID << " eliminated by " << killerID << std::endl;
+    PublishPlayerDeath(playerID, killerID);
 }
 
 void TeamDeathmatchGamemode::OnPlayerRespawn(uint32_t playerID) {
@@ -150,6 +215,20 @@ int32_t TeamDeathmatchGamemode::GetWinningTeam() const {
     return -1;
 }
 
+void TeamDeathmatchGamemode::SaveState(std::vector<uint8_t>& out) const {
+    out.clear();
+    WriteState(out, roundActive);
+    WriteState(out, roundTime);
+    for (const auto& team : teams) WriteState(out, team.score);
+}
+
+void TeamDeathmatchGamemode::LoadState(const std::vector<uint8_t>& in) {
+    size_t offset = 0;
+    roundActive = ReadState<bool>(in, offset);
+    roundTime = ReadState<float>(in, offset);
+    for (auto& team : teams) team.score = ReadState<int32_t>(in, offset);
+}
+
 // ============================================================================
 // Bomb Defusal Implementation
 // ============================================================================
@@ -204,8 +283,19 @@ void BombDefusalGamemode::Shutdown() {
     std::cout << "Bomb Defusal gamemode shutdown" << std::endl;
 }
 
+void BombDefusalGamemode::SaveRoundStart() {
+    if (!world) throw std::runtime_error("Bomb Defusal gamemode has no world!");
+    roundStart.Capture(*world);
+}
+
 void BombDefusalGamemode::StartRound() {
     std::cout << "Bomb Defusal round started" << std::endl;
+
+    // Usually a delta: only chunks touched during the last round are copied back
+    if (world && roundStart.IsCaptured()) {
+        roundStart.Restore(*world);
+    }
+
     roundActive = true;
     roundTime = 0.0f;
     bombPlanted = false;
@@ -216,6 +306,7 @@ void BombDefusalGamemode::EndRound() {
     std::cout << "Bomb Defusal round ended" << std::endl;
     roundActive = false;
     bombPlanted = false;
+    PublishRoundEnded();
 }
 
 void BombDefusalGamemode::OnPlayerJoined(uint32_t playerID) {
@@ -228,6 +319,7 @@ void BombDefusalGamemode::OnPlayerLeft(uint32_t playerID) {
 
 void BombDefusalGamemode::OnPlayerDeath(uint32_t playerID, uint32_t killerID) {
     std::cout << "Player " << playerID << " eliminated by " << killerID << std::endl;
+    PublishPlayerDeath(playerID, killerID);
 }
 
 void BombDefusalGamemode::OnPlayerRespawn(uint32_t playerID) {
@@ -264,4 +356,26 @@ int32_t BombDefusalGamemode::GetWinningTeam() const {
     return -1;
 }
 
+void BombDefusalGamemode::SaveState(std::vector<uint8_t>& out) const {
+    out.clear();
+    WriteState(out, roundActive);
+    WriteState(out, roundTime);
+    WriteState(out, bombPlanted);
+    WriteState(out, bombPlantTime);
+    WriteState(out, teamATerroristWins);
+    WriteState(out, teamBCTWins);
+    for (const auto& team : teams) WriteState(out, team.score);
+}
+
+void BombDefusalGamemode::LoadState(const std::vector<uint8_t>& in) {
+    size_t offset = 0;
+    roundActive = ReadState<bool>(in, offset);
+    roundTime = ReadState<float>(in, offset);
+    bombPlanted = ReadState<bool>(in, offset);
+    bombPlantTime = ReadState<float>(in, offset);
+    teamATerroristWins = ReadState<int32_t>(in, offset);
+    teamBCTWins = ReadState<int32_t>(in, offset);
+    for (auto& team : teams) team.score = ReadState<int32_t>(in, offset);
+}
+
 } // namespace Titan
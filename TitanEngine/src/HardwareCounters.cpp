@@ -0,0 +1,155 @@
+#include "../include/HardwareCounters.hpp"
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Titan {
+
+// ============================================================================
+// HardwareCounters Implementation
+// ============================================================================
+
+std::atomic<bool> HardwareCounters::enabled{false};
+
+const char* HardwareCounters::GetName(HardwareCounter counter) {
+    switch (counter) {
+        case HardwareCounter::Cycles: return "cycles";
+        case HardwareCounter::Instructions: return "instructions";
+        case HardwareCounter::L1DataMisses: return "l1d_misses";
+        case HardwareCounter::LLCMisses: return "llc_misses";
+        case HardwareCounter::BranchMisses: return "branch_misses";
+        default: return "unknown";
+    }
+}
+
+#ifdef __linux__
+
+namespace {
+
+struct CounterConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+const CounterConfig s_configs[HARDWARE_COUNTER_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+};
+
+// One perf event group per thread: the first counter that opens leads, so a
+// single read returns every counter sampled over the same interval
+struct ThreadCounters {
+    bool opened{false};
+    int leader{-1};
+    int fds[HARDWARE_COUNTER_COUNT];
+    uint32_t order[HARDWARE_COUNTER_COUNT];  // group position -> counter
+    uint32_t count{0};
+    uint32_t mask{0};
+    std::string status;
+
+    ThreadCounters() {
+        for (int& fd : fds) fd = -1;
+    }
+
+    void Open() {
+        opened = true;
+        for (uint32_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = s_configs[i].type;
+            attr.config = s_configs[i].config;
+            attr.exclude_kernel = 1;  // allowed with perf_event_paranoid <= 2
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = leader < 0 ? 1 : 0;
+
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+            if (fd < 0) {
+                if (!status.empty()) status += "; ";
+                status += std::string(HardwareCounters::GetName(static_cast<HardwareCounter>(i))) + ": " + std::strerror(errno);
+                continue;
+            }
+            if (leader < 0) leader = fd;
+            fds[i] = fd;
+            order[count++] = i;
+            mask |= 1u << i;
+        }
+        if (leader >= 0) {
+            ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    bool Read(CounterSample& out) {
+        if (!opened) Open();
+        if (leader < 0) return false;
+
+        // nr, time enabled, time running, then one value per counter
+        uint64_t data[3 + HARDWARE_COUNTER_COUNT];
+        ssize_t bytes = read(leader, data, sizeof(data));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t)) || data[2] == 0) return false;
+
+        // Scale up when the kernel multiplexed the group with other events
+        double scale = data[2] < data[1] ? static_cast<double>(data[1]) / data[2] : 1.0;
+        out = CounterSample();
+        for (uint32_t i = 0; i < count && i < data[0]; ++i) {
+            out.values[order[i]] = static_cast<uint64_t>(data[3 + i] * scale);
+        }
+        out.validMask = mask;
+        return true;
+    }
+
+    ~ThreadCounters() {
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+    }
+};
+
+thread_local ThreadCounters t_counters;
+
+} // namespace
+
+bool HardwareCounters::Read(CounterSample& out) {
+    if (!IsEnabled()) return false;
+    return t_counters.Read(out);
+}
+
+uint32_t HardwareCounters::GetAvailableMask() {
+    if (!t_counters.opened) t_counters.Open();
+    return t_counters.mask;
+}
+
+std::string HardwareCounters::GetStatus() {
+    if (!t_counters.opened) t_counters.Open();
+    return t_counters.status;
+}
+
+#else
+
+bool HardwareCounters::Read(CounterSample&) {
+    return false;
+}
+
+uint32_t HardwareCounters::GetAvailableMask() {
+    return 0;
+}
+
+std::string HardwareCounters::GetStatus() {
+    return "hardware counters need Linux perf_event_open";
+}
+
+#endif
+
+} // namespace Titan
@@ -0,0 +1,165 @@
+#include "../include/Hierarchy.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace Titan {
+
+// ============================================================================
+// TransformHierarchy Implementation
+// ============================================================================
+
+void TransformHierarchy::SetParent(EntityID child, EntityID parent) {
+    if (parent == invalid_entity::value) {
+        ClearParent(child);
+        return;
+    }
+
+    for (EntityID ancestor = parent; ancestor != invalid_entity::value; ancestor = GetParent(ancestor)) {
+        if (ancestor == child) {
+            throw std::runtime_error("SetParent would create a cycle in the transform hierarchy");
+        }
+    }
+
+    parentOf[child] = parent;
+    orderDirty = true;
+}
+
+void TransformHierarchy::ClearParent(EntityID child) {
+    if (parentOf.erase(child) > 0) {
+        orderDirty = true;
+    }
+}
+
+EntityID TransformHierarchy::GetParent(EntityID child) const {
+    auto it = parentOf.find(child);
+    return it != parentOf.end() ? it->second : invalid_entity::value;
+}
+
+void TransformHierarchy::Update(EntityManager& entityManager) {
+    uint32_t since = cursor.Begin(entityManager);
+    lastUpdateCount = 0;
+
+    bool anyDirty = false;
+    for (size_t i = 0; i < entities.size() && !orderDirty; ++i) {
+        if (!entityManager.IsAlive(entities[i])) {
+            orderDirty = true;
+        } else if (entityManager.GetChangedVersion<Transform>(entities[i]) > since) {
+            dirty[i] = 1;
+            anyDirty = true;
+        }
+    }
+
+    if (orderDirty) {
+        Rebuild(entityManager);
+        anyDirty = !entities.empty();
+    }
+    if (!anyDirty) return;
+
+    // Parents precede children, so a dirty parent is resolved before its subtree
+    for (size_t i = 0; i < entities.size(); ++i) {
+        int32_t parent = parents[i];
+        if (parent != NO_PARENT && dirty[parent]) dirty[i] = 1;
+        if (!dirty[i]) continue;
+
+        const Transform* transform = entityManager.ReadComponent<Transform>(entities[i]);
+        glm::mat4 local = transform ? transform->GetModelMatrix() : glm::mat4(1.0f);
+        worldMatrices[i] = (parent != NO_PARENT) ? worldMatrices[parent] * local : local;
+        ++lastUpdateCount;
+    }
+    std::fill(dirty.begin(), dirty.end(), 0);
+}
+
+glm::mat4 TransformHierarchy::GetWorldMatrix(const EntityManager& entityManager, EntityID id) const {
+    auto it = nodeLookup.find(id);
+    if (it != nodeLookup.end()) return worldMatrices[it->second];
+
+    const Transform* transform = entityManager.ReadComponent<Transform>(id);
+    return transform ? transform->GetModelMatrix() : glm::mat4(1.0f);
+}
+
+void TransformHierarchy::Clear() {
+    parentOf.clear();
+    entities.clear();
+    parents.clear();
+    worldMatrices.clear();
+    dirty.clear();
+    nodeLookup.clear();
+    orderDirty = false;
+}
+
+// Re-sorts the nodes by depth and marks all of them dirty
+void TransformHierarchy::Rebuild(EntityManager& entityManager) {
+    // Links to or from destroyed entities are dropped
+    for (auto it = parentOf.begin(); it != parentOf.end();) {
+        if (!entityManager.IsAlive(it->first) || !entityManager.IsAlive(it->second)) {
+            it = parentOf.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto depthOf = [this](EntityID id) {
+        uint32_t depth = 0;
+        for (auto it = parentOf.find(id); it != parentOf.end(); it = parentOf.find(it->second)) ++depth;
+        return depth;
+    };
+
+    std::vector<std::pair<uint32_t, EntityID>> order;
+    nodeLookup.clear();
+    for (const auto& [child, parent] : parentOf) {
+        for (EntityID id : { child, parent }) {
+            if (nodeLookup.emplace(id, 0).second) {
+                order.emplace_back(depthOf(id), id);
+            }
+        }
+    }
+    std::sort(order.begin(), order.end());
+
+    entities.resize(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        entities[i] = order[i].second;
+        nodeLookup[entities[i]] = static_cast<uint32_t>(i);
+    }
+
+    parents.resize(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        auto it = parentOf.find(entities[i]);
+        parents[i] = (it != parentOf.end()) ? static_cast<int32_t>(nodeLookup[it->second]) : NO_PARENT;
+    }
+
+    worldMatrices.resize(entities.size());
+    dirty.assign(entities.size(), 1);
+    orderDirty = false;
+}
+
+// ============================================================================
+// TransformInterpolator Implementation
+// ============================================================================
+
+void TransformInterpolator::BeginTick(EntityManager& entityManager) {
+    uint32_t since = cursor.Begin(entityManager);
+    entityManager.GetView<const Transform>().Changed<Transform>(since).Each(
+        [this](EntityID id, const Transform& transform) { previous[id] = transform; });
+
+    // Destroyed entities are dropped once they could make up half the table
+    if (previous.size() > 2 * entityManager.GetEntityCount() + 64) {
+        for (auto it = previous.begin(); it != previous.end();) {
+            it = entityManager.IsAlive(it->first) ? std::next(it) : previous.erase(it);
+        }
+    }
+}
+
+Transform TransformInterpolator::Blend(EntityID id, const Transform& current, float alpha) const {
+    if (alpha >= 1.0f) return current;
+    auto it = previous.find(id);
+    return it != previous.end() ? Transform::Interpolate(it->second, current, alpha) : current;
+}
+
+void TransformInterpolator::Clear() {
+    previous.clear();
+    cursor = ChangeCursor();
+}
+
+} // namespace Titan
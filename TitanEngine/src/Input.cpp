@@ -58,12 +58,20 @@ void SimpleInputSystem::GetMouseDelta(float& deltaX, float& deltaY) const {
 }
 
 void SimpleInputSystem::OnKeyPressed(KeyCode key) {
-    pressedKeys.insert(static_cast<int>(key));
+    bool repeated = !pressedKeys.insert(static_cast<int>(key)).second;
+
+    if (keyPressedChannel) {
+        KeyPressedEvent event(key);
+        event.repeated = repeated;
+        keyPressedChannel->Publish(event);
+    }
 }
 
 void SimpleInputSystem::OnKeyReleased(KeyCode key) {
     pressedKeys.erase(static_cast<int>(key));
     releasedKeys.insert(static_cast<int>(key));
+
+    if (keyReleasedChannel) keyReleasedChannel->Publish(KeyReleasedEvent(key));
 }
 
 void SimpleInputSystem::OnMouseMoved(float x, float y) {
@@ -71,19 +79,34 @@ void SimpleInputSystem::OnMouseMoved(float x, float y) {
     mouseDeltaY = y - mouseY;
     mouseX = x;
     mouseY = y;
+
+    if (mouseMovedChannel) {
+        MouseMovedEvent event;
+        event.x = x;
+        event.y = y;
+        event.deltaX = mouseDeltaX;
+        event.deltaY = mouseDeltaY;
+        mouseMovedChannel->Publish(event);
+    }
 }
 
 void SimpleInputSystem::OnMouseButtonPressed(MouseButton button) {
     pressedMouseButtons.insert(static_cast<int>(button));
+
+    if (mouseButtonPressedChannel) mouseButtonPressedChannel->Publish(MouseButtonPressedEvent(button));
 }
 
 void SimpleInputSystem::OnMouseButtonReleased(MouseButton button) {
     pressedMouseButtons.erase(static_cast<int>(button));
     releasedMouseButtons.insert(static_cast<int>(button));
+
+    if (mouseButtonReleasedChannel) mouseButtonReleasedChannel->Publish(MouseButtonReleasedEvent(button));
 }
 
 void SimpleInputSystem::OnMouseScroll(float delta) {
     scrollDelta = delta;
+
+    if (mouseScrollChannel) mouseScrollChannel->Publish(MouseScrollEvent(delta));
 }
 
 } // namespace Titan
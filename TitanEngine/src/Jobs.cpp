@@ -0,0 +1,235 @@
+#include "../include/Jobs.hpp"
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace Titan {
+
+// Which queue the current thread owns, per job system (several may exist)
+struct WorkerIdentity {
+    const JobSystem* owner{nullptr};
+    uint32_t queue{0};
+};
+
+static thread_local WorkerIdentity t_worker;
+
+// Failed steal attempts before an idle worker goes to sleep
+static constexpr int IDLE_SPINS = 64;
+
+// ============================================================================
+// JobSystem Implementation
+// ============================================================================
+
+JobSystem::JobSystem(int workerCount) {
+    if (workerCount < 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? static_cast<int>(hardware - 1) : 0;
+    }
+
+    queues.reserve(workerCount + 1);
+    for (int i = 0; i <= workerCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, static_cast<uint32_t>(i + 1));
+    }
+}
+
+JobSystem::~JobSystem() {
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Jobs still queued at shutdown never ran; drop them
+    for (auto& queue : queues) {
+        queue->jobs.clear();
+    }
+}
+
+void JobSystem::Run(JobFunction function, JobCounter* counter) {
+    if (counter) counter->value.fetch_add(1, std::memory_order_relaxed);
+    Push(Job{ std::move(function), counter });
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, JobFunction function, JobCounter* counter) {
+    if (counter) counter->value.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if (dependency.value.load(std::memory_order_acquire) > 0) {
+            dependency.continuations.push_back(Job{ std::move(function), counter });
+            return;
+        }
+    }
+
+    Push(Job{ std::move(function), counter });
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (counter.value.load(std::memory_order_acquire) > 0) {
+        if (!RunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // The last job to finish holds this lock while it releases continuations;
+    // taking it here means the counter is safe to destroy once Wait returns.
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(counter.mutex);
+        std::swap(error, counter.error);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void JobSystem::ParallelFor(size_t count, const std::function<void(size_t, size_t)>& body, size_t minBatchSize) {
+    if (count == 0) return;
+
+    // About four batches per thread leaves room for stealing to even out load
+    size_t batchSize = (count + GetThreadCount() * 4 - 1) / (GetThreadCount() * 4);
+    batchSize = std::max(batchSize, std::max<size_t>(minBatchSize, 1));
+
+    if (workers.empty() || batchSize >= count) {
+        body(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = 0; begin < count; begin += batchSize) {
+        size_t end = std::min(begin + batchSize, count);
+        Run([&body, begin, end]() { body(begin, end); }, &counter);
+    }
+    Wait(counter);
+}
+
+bool JobSystem::RunPendingJob() {
+    Job job;
+    if (!Pop(CurrentQueue(), job)) return false;
+    Execute(job);
+    return true;
+}
+
+void JobSystem::WorkerLoop(uint32_t queueIndex) {
+    t_worker.owner = this;
+    t_worker.queue = queueIndex;
+    Profiler::SetThreadName("Worker " + std::to_string(queueIndex));
+
+    int idleSpins = 0;
+    while (!stopping.load(std::memory_order_relaxed)) {
+        Job job;
+        if (Pop(queueIndex, job)) {
+            Execute(job);
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Push() checks sleepingWorkers after publishing queuedJobs, so one of
+        // the two sides always sees the other and no wakeup is lost
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1);
+        sleepCondition.wait(lock, [this]() {
+            return stopping.load() || queuedJobs.load() > 0;
+        });
+        sleepingWorkers.fetch_sub(1);
+        idleSpins = 0;
+    }
+}
+
+void JobSystem::Push(Job job) {
+    WorkQueue& queue = *queues[CurrentQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    queuedJobs.fetch_add(1);
+
+    if (sleepingWorkers.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        sleepCondition.notify_one();
+    }
+}
+
+bool JobSystem::Pop(uint32_t queueIndex, Job& job) {
+    if (queuedJobs.load(std::memory_order_relaxed) == 0) return false;
+
+    // Own queue first, newest job first
+    {
+        WorkQueue& own = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Steal the oldest job from the others
+    const uint32_t queueCount = static_cast<uint32_t>(queues.size());
+    for (uint32_t offset = 1; offset < queueCount; ++offset) {
+        WorkQueue& victim = *queues[(queueIndex + offset) % queueCount];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.jobs.empty()) continue;
+
+        job = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        queuedJobs.fetch_sub(1);
+        stolenJobs.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void JobSystem::Execute(Job& job) {
+    try {
+        job.function();
+    }
+    catch (...) {
+        if (job.counter) {
+            std::lock_guard<std::mutex> lock(job.counter->mutex);
+            if (!job.counter->error) job.counter->error = std::current_exception();
+        }
+        else {
+            std::cerr << "Unhandled exception in job" << std::endl;
+        }
+    }
+
+    executedJobs.fetch_add(1, std::memory_order_relaxed);
+    if (job.counter) Finish(*job.counter);
+}
+
+void JobSystem::Finish(JobCounter& counter) {
+    std::vector<Job> released;
+    {
+        std::lock_guard<std::mutex> lock(counter.mutex);
+        if (counter.value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            released.swap(counter.continuations);
+        }
+    }
+
+    for (auto& job : released) {
+        Push(std::move(job));
+    }
+}
+
+uint32_t JobSystem::CurrentQueue() const {
+    return t_worker.owner == this ? t_worker.queue : 0;
+}
+
+} // namespace Titan
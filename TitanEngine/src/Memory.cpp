@@ -0,0 +1,386 @@
+#include "../include/Memory.hpp"
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+
+namespace Titan {
+
+// ============================================================================
+// LinearArena Implementation
+// ============================================================================
+
+static constexpr size_t ARENA_BLOCK_ALIGNMENT = 64;
+
+LinearArena::LinearArena(size_t defaultBlockSize)
+    : blockSize(std::max<size_t>(defaultBlockSize, ARENA_BLOCK_ALIGNMENT)) {
+}
+
+LinearArena::~LinearArena() {
+    for (auto& block : blocks) {
+        ::operator delete(block.data, std::align_val_t{ARENA_BLOCK_ALIGNMENT});
+    }
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment) {
+    while (currentBlock < blocks.size()) {
+        Block& block = blocks[currentBlock];
+        size_t start = (offset + alignment - 1) & ~(alignment - 1);
+        if (start + size <= block.size) {
+            usedBytes += start + size - offset;
+            peakBytes = std::max(peakBytes, usedBytes);
+            offset = start + size;
+            return block.data + start;
+        }
+
+        // Skip to the next block; the tail of this one is wasted until Reset
+        usedBytes += block.size - offset;
+        ++currentBlock;
+        offset = 0;
+    }
+
+    // Out of blocks: add one large enough for this request
+    Block block;
+    block.size = std::max(blockSize, size + alignment);
+    block.data = static_cast<uint8_t*>(::operator new(block.size, std::align_val_t{ARENA_BLOCK_ALIGNMENT}));
+    blocks.push_back(block);
+    currentBlock = blocks.size() - 1;
+    offset = 0;
+    return Allocate(size, alignment);
+}
+
+void LinearArena::Reset() {
+    currentBlock = 0;
+    offset = 0;
+    usedBytes = 0;
+}
+
+void LinearArena::Rewind(const Marker& marker) {
+    currentBlock = marker.block;
+    offset = marker.offset;
+    usedBytes = marker.used;
+}
+
+size_t LinearArena::GetCapacity() const {
+    size_t total = 0;
+    for (const auto& block : blocks) total += block.size;
+    return total;
+}
+
+LinearArena& GetThreadScratchArena() {
+    static thread_local LinearArena arena(64 * 1024);
+    return arena;
+}
+
+// ============================================================================
+// Allocation Tracking Implementation
+// ============================================================================
+
+// Everything here is static storage: tracking must never allocate itself,
+// since it runs inside operator new
+
+namespace {
+
+constexpr size_t MAX_CALL_SITES = 64;
+constexpr size_t BLOCK_HEADER_SIZE = 16;
+
+struct BlockHeader {
+    uint64_t size;
+    uint32_t tag;
+    uint32_t offset;  // from the start of the malloc'd block to the user pointer
+};
+static_assert(sizeof(BlockHeader) <= BLOCK_HEADER_SIZE, "Allocation header too large");
+
+struct TagCounters {
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> frees;
+    std::atomic<uint64_t> allocatedBytes;
+    std::atomic<uint64_t> freedBytes;
+};
+
+struct CallSiteCounters {
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> bytes;
+};
+
+// Written by one owning thread, except slot 0 which any thread may share
+struct ThreadSlot {
+    std::atomic<bool> inUse;
+    TagCounters tags[MAX_MEMORY_TAGS];
+    CallSiteCounters sites[MAX_CALL_SITES];
+    CallSiteCounters otherSites;  // once sites is full
+};
+
+ThreadSlot s_slots[MAX_TRACKED_THREADS];
+
+std::mutex s_tagMutex;
+const char* s_tagNames[MAX_MEMORY_TAGS] = { "Untagged" };
+std::atomic<uint32_t> s_tagCount{1};
+
+thread_local ThreadSlot* t_slot = nullptr;
+thread_local bool t_exited = false;
+thread_local MemoryTag t_tag = UNTAGGED_MEMORY;
+
+// Owners add without a locked instruction; the shared slot needs one
+void Add(std::atomic<uint64_t>& counter, uint64_t value, bool shared) {
+    if (shared) counter.fetch_add(value, std::memory_order_relaxed);
+    else counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+CallSiteCounters& FindSite(ThreadSlot& slot, const char* name) {
+    size_t hash = static_cast<size_t>((reinterpret_cast<uintptr_t>(name) >> 3) * 0x9E3779B97F4A7C15ull);
+    for (size_t probe = 0; probe < MAX_CALL_SITES; ++probe) {
+        CallSiteCounters& site = slot.sites[(hash + probe) % MAX_CALL_SITES];
+        const char* current = site.name.load(std::memory_order_acquire);
+        if (current == name) return site;
+        if (!current) {
+            const char* expected = nullptr;
+            if (site.name.compare_exchange_strong(expected, name, std::memory_order_acq_rel) || expected == name) {
+                return site;
+            }
+        }
+    }
+    return slot.otherSites;
+}
+
+void ReleaseSlot(ThreadSlot& slot);
+
+// Hands the slot back when the thread exits
+struct SlotOwner {
+    ~SlotOwner() {
+        if (t_slot) ReleaseSlot(*t_slot);
+        t_slot = nullptr;
+        t_exited = true;
+    }
+};
+
+thread_local SlotOwner t_owner;
+
+ThreadSlot& CurrentSlot() {
+    if (t_slot) return *t_slot;
+    if (t_exited) return s_slots[0];
+
+    for (size_t i = 1; i < MAX_TRACKED_THREADS; ++i) {
+        bool expected = false;
+        if (s_slots[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            t_slot = &s_slots[i];
+            (void)&t_owner;  // Registers the exit hook for this thread
+            return *t_slot;
+        }
+    }
+    t_exited = true;  // No slot free: share slot 0 from now on
+    return s_slots[0];
+}
+
+// Folds an exiting thread's counts into slot 0 so totals survive it
+void ReleaseSlot(ThreadSlot& slot) {
+    ThreadSlot& retired = s_slots[0];
+    for (size_t tag = 0; tag < MAX_MEMORY_TAGS; ++tag) {
+        TagCounters& from = slot.tags[tag];
+        TagCounters& to = retired.tags[tag];
+        to.allocations.fetch_add(from.allocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.frees.fetch_add(from.frees.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.allocatedBytes.fetch_add(from.allocatedBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.freedBytes.fetch_add(from.freedBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    auto fold = [](CallSiteCounters& from, CallSiteCounters& to) {
+        to.allocations.fetch_add(from.allocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.bytes.fetch_add(from.bytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    };
+    for (CallSiteCounters& site : slot.sites) {
+        const char* name = site.name.exchange(nullptr, std::memory_order_acq_rel);
+        if (name) fold(site, FindSite(retired, name));
+    }
+    fold(slot.otherSites, retired.otherSites);
+    slot.inUse.store(false, std::memory_order_release);
+}
+
+void Accumulate(AllocationCounters& into, const AllocationCounters& value) {
+    into.allocations += value.allocations;
+    into.frees += value.frees;
+    into.allocatedBytes += value.allocatedBytes;
+    into.freedBytes += value.freedBytes;
+}
+
+// Counters are cumulative, but a reused thread slot restarts from zero
+AllocationCounters Difference(const AllocationCounters& current, const AllocationCounters& previous) {
+    if (current.allocations < previous.allocations || current.frees < previous.frees) return current;
+    AllocationCounters result;
+    result.allocations = current.allocations - previous.allocations;
+    result.frees = current.frees - previous.frees;
+    result.allocatedBytes = current.allocatedBytes - previous.allocatedBytes;
+    result.freedBytes = current.freedBytes - previous.freedBytes;
+    return result;
+}
+
+} // namespace
+
+MemoryTag RegisterMemoryTag(const char* name) {
+    std::lock_guard<std::mutex> lock(s_tagMutex);
+    uint32_t count = s_tagCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (s_tagNames[i] == name || std::strcmp(s_tagNames[i], name) == 0) return i;
+    }
+    if (count == MAX_MEMORY_TAGS) return static_cast<MemoryTag>(MAX_MEMORY_TAGS - 1);
+
+    s_tagNames[count] = name;
+    s_tagCount.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+const char* GetMemoryTagName(MemoryTag tag) {
+    return tag < s_tagCount.load(std::memory_order_acquire) ? s_tagNames[tag] : "Invalid";
+}
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag)
+    : previous(t_tag) {
+    t_tag = tag < MAX_MEMORY_TAGS ? tag : UNTAGGED_MEMORY;
+}
+
+MemoryTagScope::~MemoryTagScope() {
+    t_tag = previous;
+}
+
+AllocationSnapshot AllocationSnapshot::Since(const AllocationSnapshot& previous) const {
+    AllocationSnapshot result;
+    for (size_t i = 0; i < MAX_MEMORY_TAGS; ++i) {
+        result.tags[i] = Difference(tags[i], previous.tags[i]);
+        Accumulate(result.total, result.tags[i]);
+    }
+    for (size_t i = 0; i < MAX_TRACKED_THREADS; ++i) {
+        result.threads[i] = Difference(threads[i], previous.threads[i]);
+    }
+    return result;
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment) {
+    return Allocate(size, alignment, t_tag);
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment, MemoryTag tag) {
+    // malloc already aligns to max_align_t; larger alignments need slack
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    size_t padding = BLOCK_HEADER_SIZE + (alignment > alignof(std::max_align_t) ? alignment : 0);
+    uint8_t* raw = static_cast<uint8_t*>(std::malloc(size + padding));
+    if (!raw) return nullptr;
+
+    uintptr_t user = (reinterpret_cast<uintptr_t>(raw) + BLOCK_HEADER_SIZE + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(user - BLOCK_HEADER_SIZE);
+    header->size = size;
+    header->tag = tag;
+    header->offset = static_cast<uint32_t>(user - reinterpret_cast<uintptr_t>(raw));
+
+    ThreadSlot& slot = CurrentSlot();
+    bool shared = &slot == &s_slots[0];
+    TagCounters& counters = slot.tags[tag < MAX_MEMORY_TAGS ? tag : UNTAGGED_MEMORY];
+    Add(counters.allocations, 1, shared);
+    Add(counters.allocatedBytes, size, shared);
+
+    const char* zone = Profiler::CurrentZone();
+    CallSiteCounters& site = FindSite(slot, zone ? zone : GetMemoryTagName(tag));
+    Add(site.allocations, 1, shared);
+    Add(site.bytes, size, shared);
+    return reinterpret_cast<void*>(user);
+}
+
+void MemoryTracker::Free(void* pointer) {
+    if (!pointer) return;
+
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(pointer) - BLOCK_HEADER_SIZE);
+    ThreadSlot& slot = CurrentSlot();
+    bool shared = &slot == &s_slots[0];
+    TagCounters& counters = slot.tags[header->tag < MAX_MEMORY_TAGS ? header->tag : UNTAGGED_MEMORY];
+    Add(counters.frees, 1, shared);
+    Add(counters.freedBytes, header->size, shared);
+
+    std::free(static_cast<uint8_t*>(pointer) - header->offset);
+}
+
+MemoryTag MemoryTracker::GetCurrentTag() {
+    return t_tag;
+}
+
+uint32_t MemoryTracker::GetThreadSlot() {
+    return static_cast<uint32_t>(&CurrentSlot() - s_slots);
+}
+
+void MemoryTracker::TakeSnapshot(AllocationSnapshot& out) {
+    out = AllocationSnapshot();
+    for (size_t t = 0; t < MAX_TRACKED_THREADS; ++t) {
+        for (size_t tag = 0; tag < MAX_MEMORY_TAGS; ++tag) {
+            const TagCounters& counters = s_slots[t].tags[tag];
+            AllocationCounters value;
+            value.allocations = counters.allocations.load(std::memory_order_relaxed);
+            value.frees = counters.frees.load(std::memory_order_relaxed);
+            value.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+            value.freedBytes = counters.freedBytes.load(std::memory_order_relaxed);
+            Accumulate(out.tags[tag], value);
+            Accumulate(out.threads[t], value);
+            Accumulate(out.total, value);
+        }
+    }
+}
+
+std::vector<MemoryTracker::CallSite> MemoryTracker::GetTopCallSites(size_t count) {
+    std::vector<CallSite> sites;
+    auto merge = [&sites](const char* name, const CallSiteCounters& counters) {
+        uint64_t allocations = counters.allocations.load(std::memory_order_relaxed);
+        if (allocations == 0) return;
+        uint64_t bytes = counters.bytes.load(std::memory_order_relaxed);
+        for (CallSite& site : sites) {
+            if (site.name == name || std::strcmp(site.name, name) == 0) {
+                site.allocations += allocations;
+                site.bytes += bytes;
+                return;
+            }
+        }
+        sites.push_back(CallSite{ name, allocations, bytes });
+    };
+
+    for (const ThreadSlot& slot : s_slots) {
+        for (const CallSiteCounters& site : slot.sites) {
+            const char* name = site.name.load(std::memory_order_acquire);
+            if (name) merge(name, site);
+        }
+        merge("(other)", slot.otherSites);
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const CallSite& a, const CallSite& b) {
+        return a.allocations > b.allocations;
+    });
+    if (sites.size() > count) sites.resize(count);
+    return sites;
+}
+
+void MemoryTracker::PrintReport(std::ostream& out, size_t topSites) {
+    AllocationSnapshot snapshot;
+    TakeSnapshot(snapshot);
+
+    out << "Allocations by tag:\n";
+    out << std::left << std::setw(20) << "  tag" << std::right
+        << std::setw(14) << "allocations" << std::setw(14) << "frees"
+        << std::setw(14) << "live KiB" << std::setw(14) << "total KiB" << "\n";
+    uint32_t tagCount = s_tagCount.load(std::memory_order_acquire);
+    for (uint32_t tag = 0; tag < tagCount; ++tag) {
+        const AllocationCounters& counters = snapshot.tags[tag];
+        if (counters.allocations == 0 && counters.frees == 0) continue;
+        out << "  " << std::left << std::setw(18) << GetMemoryTagName(tag) << std::right
+            << std::setw(14) << counters.allocations << std::setw(14) << counters.frees
+            << std::setw(14) << counters.GetLiveBytes() / 1024
+            << std::setw(14) << counters.allocatedBytes / 1024 << "\n";
+    }
+
+    std::vector<CallSite> sites = GetTopCallSites(topSites);
+    out << "Top " << sites.size() << " call sites:\n";
+    for (const CallSite& site : sites) {
+        out << "  " << std::left << std::setw(18) << site.name << std::right
+            << std::setw(14) << site.allocations << std::setw(14) << site.bytes / 1024 << " KiB\n";
+    }
+}
+
+} // namespace Titan
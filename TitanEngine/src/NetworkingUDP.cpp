@@ -1,4 +1,5 @@
 #include "../include/NetworkingUDP.hpp"
+#include "../include/Memory.hpp"
 #include <winsock2.h>
 #include <ws2tcpip.h>
 #include <stdexcept>
@@ -143,10 +144,10 @@ void UDPServer::PushSnapshot(int playerId, const Snapshot& snap) {
 
 void UDPServer::Update() {
     // Receive incoming packets and handle acks/inputs
-    std::string host; uint16_t port; std::vector<uint8_t> data;
-    while (transport->ReceiveFrom(host, port, data)) {
+    uint16_t port = 0;
+    while (transport->ReceiveFrom(receiveHost, port, receiveBuffer)) {
         // Basic: ignore payload processing for now
-        (void)host; (void)port; (void)data;
+        (void)port;
     }
 
     // Tick logic: broadcast snapshots at tickRate
@@ -154,21 +155,19 @@ void UDPServer::Update() {
     auto elapsed = std::chrono::duration<float>(now - lastTick).count();
     float targetSec = 1.0f / static_cast<float>(tickRate);
     if (elapsed >= targetSec) {
-        // Build a simple packet with tick and all player snapshots
+        // Build one packet with tick and all player snapshots in scratch memory
+        // and send it to every client.
+        // packet format: tick(uint32), count(uint32), repeated snapshots
+        LinearArena& scratch = GetThreadScratchArena();
+        ArenaScope scope(scratch);
+
+        uint32_t tick = ++tickCounter;
+        uint32_t count = static_cast<uint32_t>(snapshotBuffer.size());
+        Span<uint8_t> out = scratch.AllocateArray<uint8_t>(GetSnapshotPacketSize(count));
+        WriteSnapshotPacket(tick, snapshotBuffer.data(), count, out.data);
+
         for (const auto& client : clients) {
-            std::vector<uint8_t> out;
-            // packet format: tick(uint32), count(uint32), repeated snapshots
-            uint32_t tick = ++tickCounter;
-            out.resize(8);
-            memcpy(out.data(), &tick, 4);
-            uint32_t count = static_cast<uint32_t>(snapshotBuffer.size());
-            memcpy(out.data() + 4, &count, 4);
-            for (const auto& s : snapshotBuffer) {
-                size_t old = out.size();
-                out.resize(old + sizeof(Snapshot));
-                memcpy(out.data() + old, &s, sizeof(Snapshot));
-            }
-            transport->SendTo(client.host, client.port, out.data(), out.size());
+            transport->SendTo(client.host, client.port, out.data, out.size);
         }
         lastTick = now;
     }
@@ -196,21 +195,12 @@ void UDPClient::Stop() {
 
 void UDPClient::Update() {
     // Poll for incoming packets
-    std::string host; uint16_t port; std::vector<uint8_t> data;
-    while (transport->ReceiveFrom(host, port, data)) {
-        if (data.size() < 8) continue;
-        uint32_t tick = 0; uint32_t count = 0;
-        memcpy(&tick, data.data(), 4);
-        memcpy(&count, data.data() + 4, 4);
-        size_t expected = 8 + count * sizeof(Snapshot);
-        if (data.size() != expected) continue;
-        const uint8_t* ptr = data.data() + 8;
-        for (uint32_t i = 0; i < count; ++i) {
-            Snapshot s;
-            memcpy(&s, ptr, sizeof(Snapshot));
-            ptr += sizeof(Snapshot);
+    uint16_t port = 0;
+    while (transport->ReceiveFrom(receiveHost, port, receiveBuffer)) {
+        uint32_t tick = 0;
+        ReadSnapshotPacket(receiveBuffer.data(), receiveBuffer.size(), tick, [this](const Snapshot& s) {
             if (OnSnapshot) OnSnapshot(s);
-        }
+        });
     }
 }
 
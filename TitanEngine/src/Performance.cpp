@@ -1,8 +1,12 @@
 #include "../include/Performance.hpp"
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <cmath>
 #include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 
 namespace Titan {
 
@@ -47,6 +51,22 @@ bool Sphere::Intersects(const Sphere& other) const {
 // Frustum Implementation
 // ============================================================================
 
+Frustum Frustum::FromViewProjection(const glm::mat4& viewProj) {
+    // Gribb-Hartmann: each plane is the fourth row plus or minus another row
+    auto row = [&](int r) { return glm::vec4(viewProj[0][r], viewProj[1][r], viewProj[2][r], viewProj[3][r]); };
+    Frustum frustum;
+    frustum.planes[0] = row(3) + row(0);
+    frustum.planes[1] = row(3) - row(0);
+    frustum.planes[2] = row(3) - row(1);
+    frustum.planes[3] = row(3) + row(1);
+    frustum.planes[4] = row(3) + row(2);
+    frustum.planes[5] = row(3) - row(2);
+    for (glm::vec4& plane : frustum.planes) {
+        plane /= glm::length(glm::vec3(plane.x, plane.y, plane.z));
+    }
+    return frustum;
+}
+
 bool Frustum::Contains(const glm::vec3& point) const {
     for (int i = 0; i < 6; ++i) {
         if (glm::dot(planes[i], glm::vec4(point, 1.0f)) < 0.0f) {
@@ -122,59 +142,80 @@ void SpatialHash::Remove(EntityID id, const glm::vec3& position) {
     }
 }
 
-std::vector<EntityID> SpatialHash::QuerySphere(const glm::vec3& center, float radius) const {
-    std::vector<EntityID> result;
-    Sphere sphere(center, radius);
-
-    int32_t minX = static_cast<int32_t>((center.x - radius) / cellSize);
-    int32_t maxX = static_cast<int32_t>((center.x + radius) / cellSize);
-    int32_t minY = static_cast<int32_t>((center.y - radius) / cellSize);
-    int32_t maxY = static_cast<int32_t>((center.y + radius) / cellSize);
-    int32_t minZ = static_cast<int32_t>((center.z - radius) / cellSize);
-    int32_t maxZ = static_cast<int32_t>((center.z + radius) / cellSize);
+// Calls func(cell) for every non-empty grid cell overlapping [min, max]
+template<typename Func>
+static void ForEachCell(const std::unordered_map<uint32_t, SpatialHash::GridCell>& grid, float cellSize,
+                        const glm::vec3& min, const glm::vec3& max, Func&& func) {
+    int32_t minX = static_cast<int32_t>(min.x / cellSize);
+    int32_t maxX = static_cast<int32_t>(max.x / cellSize);
+    int32_t minY = static_cast<int32_t>(min.y / cellSize);
+    int32_t maxY = static_cast<int32_t>(max.y / cellSize);
+    int32_t minZ = static_cast<int32_t>(min.z / cellSize);
+    int32_t maxZ = static_cast<int32_t>(max.z / cellSize);
 
     for (int32_t x = minX; x <= maxX; ++x) {
         for (int32_t y = minY; y <= maxY; ++y) {
             for (int32_t z = minZ; z <= maxZ; ++z) {
                 uint32_t key = ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791));
                 auto it = grid.find(key);
-                if (it != grid.end()) {
-                    for (EntityID id : it->second.entities) {
-                        result.push_back(id);
-                    }
+                if (it != grid.end() && !it->second.entities.empty()) {
+                    func(it->second);
                 }
             }
         }
     }
+}
+
+// Two passes over the cells: size the span exactly, then fill it
+static Span<EntityID> CollectCells(const std::unordered_map<uint32_t, SpatialHash::GridCell>& grid, float cellSize,
+                                   const glm::vec3& min, const glm::vec3& max, LinearArena& arena) {
+    size_t count = 0;
+    ForEachCell(grid, cellSize, min, max, [&count](const SpatialHash::GridCell& cell) {
+        count += cell.entities.size();
+    });
+
+    Span<EntityID> result = arena.AllocateArray<EntityID>(count);
+    size_t written = 0;
+    ForEachCell(grid, cellSize, min, max, [&](const SpatialHash::GridCell& cell) {
+        std::copy(cell.entities.begin(), cell.entities.end(), result.data + written);
+        written += cell.entities.size();
+    });
+    return result;
+}
 
+std::vector<EntityID> SpatialHash::QuerySphere(const glm::vec3& center, float radius) const {
+    std::vector<EntityID> result;
+    QuerySphere(center, radius, result);
     return result;
 }
 
 std::vector<EntityID> SpatialHash::QueryAABB(const AABB& aabb) const {
     std::vector<EntityID> result;
+    QueryAABB(aabb, result);
+    return result;
+}
 
-    int32_t minX = static_cast<int32_t>(aabb.min.x / cellSize);
-    int32_t maxX = static_cast<int32_t>(aabb.max.x / cellSize);
-    int32_t minY = static_cast<int32_t>(aabb.min.y / cellSize);
-    int32_t maxY = static_cast<int32_t>(aabb.max.y / cellSize);
-    int32_t minZ = static_cast<int32_t>(aabb.min.z / cellSize);
-    int32_t maxZ = static_cast<int32_t>(aabb.max.z / cellSize);
+void SpatialHash::QuerySphere(const glm::vec3& center, float radius, std::vector<EntityID>& out) const {
+    out.clear();
+    ForEachCell(grid, cellSize, center - glm::vec3(radius), center + glm::vec3(radius),
+                [&out](const GridCell& cell) {
+                    out.insert(out.end(), cell.entities.begin(), cell.entities.end());
+                });
+}
 
-    for (int32_t x = minX; x <= maxX; ++x) {
-        for (int32_t y = minY; y <= maxY; ++y) {
-            for (int32_t z = minZ; z <= maxZ; ++z) {
-                uint32_t key = ((x * 73856093) ^ (y * 19349663) ^ (z * 83492791));
-                auto it = grid.find(key);
-                if (it != grid.end()) {
-                    for (EntityID id : it->second.entities) {
-                        result.push_back(id);
-                    }
-                }
-            }
-        }
-    }
+void SpatialHash::QueryAABB(const AABB& aabb, std::vector<EntityID>& out) const {
+    out.clear();
+    ForEachCell(grid, cellSize, aabb.min, aabb.max, [&out](const GridCell& cell) {
+        out.insert(out.end(), cell.entities.begin(), cell.entities.end());
+    });
+}
 
-    return result;
+Span<EntityID> SpatialHash::QuerySphere(const glm::vec3& center, float radius, LinearArena& arena) const {
+    return CollectCells(grid, cellSize, center - glm::vec3(radius), center + glm::vec3(radius), arena);
+}
+
+Span<EntityID> SpatialHash::QueryAABB(const AABB& aabb, LinearArena& arena) const {
+    return CollectCells(grid, cellSize, aabb.min, aabb.max, arena);
 }
 
 void SpatialHash::Clear() {
@@ -197,9 +238,12 @@ void CullingSystem::Shutdown() {
     std::cout << "Culling system shutdown" << std::endl;
 }
 
+void CullingSystem::DeclareAccess(SystemAccess& access) const {
+    access.Read<Transform>().Read<Renderable>().WriteResource("Culling");
+}
+
 void CullingSystem::UpdateViewFrustum(const glm::mat4& viewProj) {
-    // Extract frustum planes from view-projection matrix
-    // This is a simplified version - full implementation would extract all 6 planes
+    viewFrustum = Frustum::FromViewProjection(viewProj);
 }
 
 void CullingSystem::RegisterEntity(EntityID id) {
@@ -215,75 +259,505 @@ bool CullingSystem::IsEntityVisible(EntityID id) const {
     return visibleEntities.find(id) != visibleEntities.end();
 }
 
+// ============================================================================
+// Histogram Implementation
+// ============================================================================
+
+static uint32_t HighestBit(uint64_t value) {
+    uint32_t bit = 0;
+    for (uint32_t step = 32; step > 0; step >>= 1) {
+        if (value >> step) {
+            value >>= step;
+            bit += step;
+        }
+    }
+    return bit;
+}
+
+size_t Histogram::BucketIndex(uint64_t value) {
+    if (value < SUB_BUCKETS) return static_cast<size_t>(value);
+    uint32_t shift = HighestBit(value) - SUB_BUCKET_BITS;
+    uint64_t sub = value >> shift;  // in [SUB_BUCKETS, 2 * SUB_BUCKETS)
+    return static_cast<size_t>(shift + 1) * SUB_BUCKETS + static_cast<size_t>(sub - SUB_BUCKETS);
+}
+
+uint64_t Histogram::BucketUpperBound(size_t index) {
+    if (index < SUB_BUCKETS) return index;
+    uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS) - 1;
+    uint64_t sub = index % SUB_BUCKETS + SUB_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+}
+
+void Histogram::Record(uint64_t value) {
+    ++buckets[BucketIndex(value)];
+    min = count == 0 ? value : std::min(min, value);
+    max = std::max(max, value);
+    sum += static_cast<double>(value);
+    ++count;
+}
+
+void Histogram::Merge(const Histogram& other) {
+    if (other.count == 0) return;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    min = count == 0 ? other.min : std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    count += other.count;
+}
+
+void Histogram::Reset() {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    min = 0;
+    max = 0;
+    sum = 0.0;
+}
+
+uint64_t Histogram::Percentile(double percentile) const {
+    if (count == 0) return 0;
+
+    double clamped = std::min(100.0, std::max(0.0, percentile));
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * count)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::max(min, std::min(max, BucketUpperBound(i)));
+        }
+    }
+    return max;
+}
+
 // ============================================================================
 // Performance Monitor Implementation
 // ============================================================================
 
+// Times are histogrammed in nanoseconds, everything else as is
+static constexpr double NANOSECONDS = 1e9;
+
+static bool IsTimeMetric(PerformanceMonitor::Metric metric) {
+    using Metric = PerformanceMonitor::Metric;
+    return metric == Metric::FrameTime || metric == Metric::WorkTime || metric == Metric::RenderTime ||
+           metric == Metric::PhysicsTime || metric == Metric::ScriptTime;
+}
+
+static double MetricValue(const PerformanceMonitor::FrameStats& frame, PerformanceMonitor::Metric metric) {
+    using Metric = PerformanceMonitor::Metric;
+    switch (metric) {
+        case Metric::FrameTime: return frame.deltaTime;
+        case Metric::WorkTime: return frame.workTime;
+        case Metric::RenderTime: return frame.renderTime;
+        case Metric::PhysicsTime: return frame.physicsTime;
+        case Metric::ScriptTime: return frame.scriptTime;
+        case Metric::EntityCount: return frame.entityCount;
+        case Metric::RenderedEntities: return frame.renderedEntities;
+        case Metric::ScratchBytes: return static_cast<double>(frame.scratchBytes);
+        case Metric::Allocations: return frame.allocations;
+        case Metric::AllocatedBytes: return static_cast<double>(frame.allocatedBytes);
+        case Metric::Cycles: return static_cast<double>(frame.counters.Get(HardwareCounter::Cycles));
+        case Metric::Instructions: return static_cast<double>(frame.counters.Get(HardwareCounter::Instructions));
+        case Metric::L1DataMisses: return static_cast<double>(frame.counters.Get(HardwareCounter::L1DataMisses));
+        case Metric::LLCMisses: return static_cast<double>(frame.counters.Get(HardwareCounter::LLCMisses));
+        case Metric::BranchMisses: return static_cast<double>(frame.counters.Get(HardwareCounter::BranchMisses));
+        default: return 0.0;
+    }
+}
+
+// Counter metrics exist only for frames that measured them
+static bool HasMetric(const PerformanceMonitor::FrameStats& frame, PerformanceMonitor::Metric metric) {
+    using Metric = PerformanceMonitor::Metric;
+    if (metric < Metric::Cycles) return true;
+    return frame.counters.Has(static_cast<HardwareCounter>(static_cast<int>(metric) - static_cast<int>(Metric::Cycles)));
+}
+
+static uint64_t ToNanoseconds(double seconds) {
+    return seconds > 0.0 ? static_cast<uint64_t>(seconds * NANOSECONDS + 0.5) : 0;
+}
+
+PerformanceMonitor::PerformanceMonitor(size_t maxHistory)
+    : frameHistory(maxHistory) {
+}
+
+void PerformanceMonitor::Reset() {
+    frameHistory.Clear();
+    for (Histogram& histogram : lifetime) {
+        histogram.Reset();
+    }
+    systems.clear();
+    haveAllocationTotals = false;
+    frameAllocations = AllocationSnapshot();
+    frameOpen = false;
+    started = false;
+    lastScratchBytes = 0;
+    peakScratchBytes = 0;
+}
+
 void PerformanceMonitor::StartFrame() {
-    frameStartTime = std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1e9;
+    if (frameOpen) EndFrame();
+
+    Clock::time_point now = Clock::now();
+    FrameStats frame;
+    if (started) frame.deltaTime = std::chrono::duration<float>(now - frameStart).count();
+    frameHistory.Push(frame);
+
+    for (SystemSeries& system : systems) {
+        system.frameTime = 0.0f;
+        system.frameCounters = CounterSample();
+    }
+    frameStart = now;
+    started = true;
+    frameOpen = true;
 }
 
 void PerformanceMonitor::EndFrame() {
-    if (frameHistory.size() >= maxHistory) {
-        frameHistory.erase(frameHistory.begin());
+    if (!frameOpen) return;
+    frameOpen = false;
+
+    FrameStats& frame = frameHistory.Back();
+    frame.workTime = std::chrono::duration<float>(Clock::now() - frameStart).count();
+
+    for (size_t i = 0; i < METRIC_COUNT; ++i) {
+        Metric metric = static_cast<Metric>(i);
+        if (!HasMetric(frame, metric)) continue;
+        double value = MetricValue(frame, metric);
+        lifetime[i].Record(IsTimeMetric(metric) ? ToNanoseconds(value) : static_cast<uint64_t>(value));
+    }
+    for (SystemSeries& system : systems) {
+        system.history.Push(system.frameTime);
+        system.counterHistory.Push(system.frameCounters);
+        system.lifetime.Record(ToNanoseconds(system.frameTime));
     }
 }
 
+void PerformanceMonitor::RecordFrameTime(float seconds) {
+    if (frameOpen) frameHistory.Back().deltaTime = seconds;
+}
+
 void PerformanceMonitor::RecordRenderTime(float time) {
-    if (!frameHistory.empty()) {
-        frameHistory.back().renderTime = time;
-    }
+    if (frameOpen) frameHistory.Back().renderTime = time;
 }
 
 void PerformanceMonitor::RecordPhysicsTime(float time) {
-    if (!frameHistory.empty()) {
-        frameHistory.back().physicsTime = time;
-    }
+    if (frameOpen) frameHistory.Back().physicsTime = time;
 }
 
 void PerformanceMonitor::RecordScriptTime(float time) {
-    if (!frameHistory.empty()) {
-        frameHistory.back().scriptTime = time;
-    }
+    if (frameOpen) frameHistory.Back().scriptTime = time;
 }
 
 void PerformanceMonitor::RecordEntityCount(uint32_t count) {
-    if (!frameHistory.empty()) {
-        frameHistory.back().entityCount = count;
-    }
+    if (frameOpen) frameHistory.Back().entityCount = count;
 }
 
 void PerformanceMonitor::RecordRenderedEntities(uint32_t count) {
-    if (!frameHistory.empty()) {
-        frameHistory.back().renderedEntities = count;
+    if (frameOpen) frameHistory.Back().renderedEntities = count;
+}
+
+void PerformanceMonitor::RecordScratchUsage(size_t bytes) {
+    lastScratchBytes = bytes;
+    peakScratchBytes = std::max(peakScratchBytes, bytes);
+    if (frameOpen) frameHistory.Back().scratchBytes = bytes;
+}
+
+void PerformanceMonitor::RecordAllocations(const AllocationSnapshot& totals) {
+    if (haveAllocationTotals) {
+        frameAllocations = totals.Since(allocationTotals);
+        if (frameOpen) {
+            frameHistory.Back().allocations = static_cast<uint32_t>(frameAllocations.total.allocations);
+            frameHistory.Back().allocatedBytes = static_cast<size_t>(frameAllocations.total.allocatedBytes);
+        }
     }
+    allocationTotals = totals;
+    haveAllocationTotals = true;
 }
 
-float PerformanceMonitor::GetAverageFPS() const {
-    if (frameHistory.empty()) return 0.0f;
+void PerformanceMonitor::RecordSystemTime(const char* name, float seconds) {
+    if (!frameOpen) return;
+    GetOrAddSystem(name).frameTime += seconds;
+}
+
+void PerformanceMonitor::RecordSystemCounters(const char* name, const CounterSample& counters) {
+    if (!frameOpen || counters.Empty()) return;
+    GetOrAddSystem(name).frameCounters += counters;
+    frameHistory.Back().counters += counters;
+}
+
+PerformanceMonitor::SystemSeries& PerformanceMonitor::GetOrAddSystem(const char* name) {
+    if (SystemSeries* system = FindSystem(name)) return *system;
+    systems.emplace_back(name, frameHistory.Capacity());
+    return systems.back();
+}
+
+PerformanceMonitor::SystemSeries* PerformanceMonitor::FindSystem(const char* name) {
+    for (SystemSeries& system : systems) {
+        if (system.name == name || std::strcmp(system.name, name) == 0) return &system;
+    }
+    return nullptr;
+}
+
+const PerformanceMonitor::SystemSeries* PerformanceMonitor::FindSystem(const char* name) const {
+    return const_cast<PerformanceMonitor*>(this)->FindSystem(name);
+}
+
+// Nearest-rank percentiles over values, which get sorted
+PerformanceMonitor::Summary PerformanceMonitor::Summarize(std::vector<double>& values) {
+    Summary summary;
+    if (values.empty()) return summary;
+
+    std::sort(values.begin(), values.end());
+    auto rank = [&values](double percentile) {
+        size_t index = static_cast<size_t>(std::ceil(percentile / 100.0 * values.size()));
+        return values[std::max<size_t>(1, index) - 1];
+    };
+
+    double sum = 0.0;
+    for (double value : values) sum += value;
+    summary.samples = values.size();
+    summary.mean = sum / values.size();
+    summary.p50 = rank(50.0);
+    summary.p95 = rank(95.0);
+    summary.p99 = rank(99.0);
+    summary.max = values.back();
+    return summary;
+}
 
+PerformanceMonitor::Summary PerformanceMonitor::Summarize(const Histogram& histogram, double scale) {
+    Summary summary;
+    summary.samples = histogram.GetCount();
+    summary.mean = histogram.GetMean() * scale;
+    summary.p50 = histogram.Percentile(50.0) * scale;
+    summary.p95 = histogram.Percentile(95.0) * scale;
+    summary.p99 = histogram.Percentile(99.0) * scale;
+    summary.max = histogram.GetMax() * scale;
+    return summary;
+}
+
+PerformanceMonitor::Summary PerformanceMonitor::GetWindowStats(Metric metric, size_t frames) const {
+    // The open frame is still incomplete
+    size_t available = frameHistory.Size() - (frameOpen ? 1 : 0);
+    size_t count = frames == 0 ? available : std::min(frames, available);
+
+    scratch.clear();
+    for (size_t i = available - count; i < available; ++i) {
+        if (HasMetric(frameHistory[i], metric)) scratch.push_back(MetricValue(frameHistory[i], metric));
+    }
+    return Summarize(scratch);
+}
+
+PerformanceMonitor::Summary PerformanceMonitor::GetLifetimeStats(Metric metric) const {
+    return Summarize(lifetime[static_cast<size_t>(metric)], IsTimeMetric(metric) ? 1.0 / NANOSECONDS : 1.0);
+}
+
+PerformanceMonitor::Summary PerformanceMonitor::GetSystemWindowStats(const char* name, size_t frames) const {
+    scratch.clear();
+    if (const SystemSeries* system = FindSystem(name)) {
+        size_t available = system->history.Size();
+        size_t count = frames == 0 ? available : std::min(frames, available);
+        for (size_t i = available - count; i < available; ++i) {
+            scratch.push_back(system->history[i]);
+        }
+    }
+    return Summarize(scratch);
+}
+
+PerformanceMonitor::Summary PerformanceMonitor::GetSystemLifetimeStats(const char* name) const {
+    const SystemSeries* system = FindSystem(name);
+    return system ? Summarize(system->lifetime, 1.0 / NANOSECONDS) : Summary();
+}
+
+CounterSample PerformanceMonitor::GetSystemCounters(const char* name, size_t frames) const {
+    CounterSample sum;
+    if (const SystemSeries* system = FindSystem(name)) {
+        size_t available = system->counterHistory.Size();
+        size_t count = frames == 0 ? available : std::min(frames, available);
+        for (size_t i = available - count; i < available; ++i) {
+            sum += system->counterHistory[i];
+        }
+    }
+    return sum;
+}
+
+std::vector<const char*> PerformanceMonitor::GetSystemNames() const {
+    std::vector<const char*> names;
+    for (const SystemSeries& system : systems) {
+        names.push_back(system.name);
+    }
+    return names;
+}
+
+std::vector<PerformanceMonitor::SystemCost> PerformanceMonitor::GetTopSystems(size_t count, size_t frames) const {
+    std::vector<SystemCost> costs;
+    for (const SystemSeries& system : systems) {
+        costs.push_back(SystemCost{ system.name, GetSystemWindowStats(system.name, frames) });
+    }
+    std::sort(costs.begin(), costs.end(), [](const SystemCost& a, const SystemCost& b) {
+        return a.time.mean != b.time.mean ? a.time.mean > b.time.mean : a.time.p99 > b.time.p99;
+    });
+    if (costs.size() > count) costs.resize(count);
+    return costs;
+}
+
+void PerformanceMonitor::PrintTopSystems(std::ostream& out, size_t count, size_t frames) const {
+    double total = 0.0;
+    for (const SystemCost& cost : GetTopSystems(systems.size(), frames)) {
+        total += cost.time.mean;
+    }
+
+    std::vector<SystemCost> top = GetTopSystems(count, frames);
+    size_t window = top.empty() ? 0 : static_cast<size_t>(top.front().time.samples);
+    bool counters = false;
+    for (const SystemCost& cost : top) {
+        counters = counters || !GetSystemCounters(cost.name, window).Empty();
+    }
+
+    out << "Top " << top.size() << " systems over " << window << " frames (ms per frame):\n";
+    out << std::left << std::setw(16) << "  system" << std::right
+        << std::setw(10) << "mean" << std::setw(10) << "p95" << std::setw(10) << "p99"
+        << std::setw(10) << "max" << std::setw(9) << "share";
+    if (counters) out << std::setw(7) << "IPC" << std::setw(12) << "L1D miss/f" << std::setw(12) << "LLC miss/f";
+    out << "\n";
+
+    out << std::fixed;
+    for (const SystemCost& cost : top) {
+        out << "  " << std::left << std::setw(14) << cost.name << std::right << std::setprecision(3)
+            << std::setw(10) << cost.time.mean * 1000.0
+            << std::setw(10) << cost.time.p95 * 1000.0
+            << std::setw(10) << cost.time.p99 * 1000.0
+            << std::setw(10) << cost.time.max * 1000.0
+            << std::setw(8) << std::setprecision(1) << (total > 0.0 ? cost.time.mean / total * 100.0 : 0.0) << "%";
+        if (counters) {
+            CounterSample sample = GetSystemCounters(cost.name, window);
+            double perFrame = window > 0 ? 1.0 / window : 0.0;
+            out << std::setw(7) << std::setprecision(2) << sample.GetIPC() << std::setprecision(0)
+                << std::setw(12) << sample.Get(HardwareCounter::L1DataMisses) * perFrame
+                << std::setw(12) << sample.Get(HardwareCounter::LLCMisses) * perFrame;
+        }
+        out << "\n";
+    }
+    out << std::defaultfloat;
+}
+
+void PerformanceMonitor::WriteFrameStatsCsv(std::ostream& out, size_t frames) const {
+    size_t available = frameHistory.Size() - (frameOpen ? 1 : 0);
+    size_t count = frames == 0 ? available : std::min(frames, available);
+
+    out << "frame,frame_ms,work_ms,render_ms,physics_ms,script_ms,entities,rendered,scratch_bytes,"
+           "allocations,allocated_bytes";
+    for (size_t c = 0; c < HARDWARE_COUNTER_COUNT; ++c) {
+        out << ',' << HardwareCounters::GetName(static_cast<HardwareCounter>(c));
+    }
+    out << "\n";
+
+    // Counters that were not measured stay empty
+    for (size_t i = available - count; i < available; ++i) {
+        const FrameStats& frame = frameHistory[i];
+        out << i - (available - count) << ','
+            << frame.deltaTime * 1000.0f << ',' << frame.workTime * 1000.0f << ','
+            << frame.renderTime * 1000.0f << ',' << frame.physicsTime * 1000.0f << ','
+            << frame.scriptTime * 1000.0f << ',' << frame.entityCount << ',' << frame.renderedEntities << ','
+            << frame.scratchBytes << ',' << frame.allocations << ',' << frame.allocatedBytes;
+        for (size_t c = 0; c < HARDWARE_COUNTER_COUNT; ++c) {
+            out << ',';
+            HardwareCounter counter = static_cast<HardwareCounter>(c);
+            if (frame.counters.Has(counter)) out << frame.counters.Get(counter);
+        }
+        out << "\n";
+    }
+}
+
+float PerformanceMonitor::GetAverageFPS() const {
     float avgDelta = GetAverageDeltaTime();
     return avgDelta > 0.0f ? 1.0f / avgDelta : 0.0f;
 }
 
 float PerformanceMonitor::GetAverageDeltaTime() const {
-    if (frameHistory.empty()) return 0.0f;
-
-    float sum = 0.0f;
-    for (const auto& frame : frameHistory) {
-        sum += frame.deltaTime;
-    }
-    return sum / frameHistory.size();
+    return static_cast<float>(GetWindowStats(Metric::FrameTime).mean);
 }
 
 float PerformanceMonitor::GetAverageRenderTime() const {
-    if (frameHistory.empty()) return 0.0f;
+    return static_cast<float>(GetWindowStats(Metric::RenderTime).mean);
+}
+
+// ============================================================================
+// HitchRecorder Implementation
+// ============================================================================
+
+HitchRecorder::HitchRecorder(const Config& recorderConfig)
+    : config(recorderConfig), frameEnds(recorderConfig.framesBefore + 2) {}
+
+HitchRecorder::~HitchRecorder() {
+    Flush();
+}
 
-    float sum = 0.0f;
-    for (const auto& frame : frameHistory) {
-        sum += frame.renderTime;
+void HitchRecorder::Start() {
+    std::error_code error;
+    std::filesystem::create_directories(config.outputDirectory, error);
+    Profiler::SetEnabled(true);
+}
+
+void HitchRecorder::OnFrameEnd(const PerformanceMonitor& monitor) {
+    const auto& history = monitor.GetFrameHistory();
+    if (history.Empty()) return;
+    frameEnds.Push(Profiler::Now());
+    uint64_t index = frame++;
+
+    if (pending) {
+        if (--framesUntilWrite == 0) WriteCapture();
+    } else if (cooldown > 0) {
+        --cooldown;
+    } else if (captures.size() < config.maxCaptures && baselineSamples >= MIN_BASELINE_SAMPLES &&
+               frameEnds.Size() >= 2) {
+        // This frame's own duration; the monitor's deltaTime is the interval
+        // up to its StartFrame, i.e. the frame before
+        float frameTime = (frameEnds.Back() - frameEnds[frameEnds.Size() - 2]) / 1e9f;
+        if (frameTime > config.minFrameTime && frameTime > config.p95Ratio * baselineP95) {
+            Capture capture;
+            capture.frame = index;
+            capture.frameTime = frameTime;
+            capture.baselineP95 = baselineP95;
+            capture.path = (std::filesystem::path(config.outputDirectory) /
+                            ("hitch_" + std::to_string(index) + ".json")).string();
+            captures.push_back(capture);
+
+            // Frames older than the ring reach back to whatever the profiler holds
+            windowStart = frameEnds.Size() == frameEnds.Capacity() ? frameEnds[0] : 0;
+            pending = true;
+            framesUntilWrite = config.framesAfter;
+            if (framesUntilWrite == 0) WriteCapture();
+        }
+    }
+
+    // Refreshed after the check, so a spike never raises its own baseline
+    if (index % BASELINE_REFRESH_FRAMES == 0) {
+        PerformanceMonitor::Summary baseline =
+            monitor.GetWindowStats(PerformanceMonitor::Metric::FrameTime, config.baselineFrames);
+        baselineP95 = static_cast<float>(baseline.p95);
+        baselineSamples = baseline.samples;
     }
-    return sum / frameHistory.size();
+}
+
+void HitchRecorder::WriteCapture() {
+    pending = false;
+    cooldown = config.cooldownFrames;
+
+    // Copied here, between frames; formatting and disk I/O stay off the game thread
+    std::vector<Profiler::ThreadEvents> threads = Profiler::Collect(windowStart, frameEnds.Back());
+    const Capture& capture = captures.back();
+    std::cout << "Frame hitch at frame " << capture.frame << ": " << capture.frameTime * 1000.0f
+              << " ms (p95 " << capture.baselineP95 * 1000.0f << " ms), trace " << capture.path << std::endl;
+
+    Flush();
+    writer = std::thread([threads = std::move(threads), path = capture.path]() {
+        std::ofstream file(path, std::ios::binary);
+        if (file) Profiler::WriteChromeTrace(file, threads);
+        if (!file) std::cerr << "Failed to write hitch trace " << path << std::endl;
+    });
+}
+
+void HitchRecorder::Flush() {
+    if (writer.joinable()) writer.join();
 }
 
 } // namespace Titan
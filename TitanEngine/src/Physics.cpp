@@ -1,5 +1,6 @@
 #include "../include/Physics.hpp"
-#include "../include/Engine.hpp"
+#include "../include/Jobs.hpp"
+#include <stdexcept>
 #include <iostream>
 
 namespace Titan {
@@ -14,24 +15,35 @@ void SimplePhysicsSystem::Initialize() {
 }
 
 void SimplePhysicsSystem::Update(float deltaTime) {
-    // Update all rigid bodies
-    for (auto& [entityID, rigidBody] : rigidBodies) {
-        UpdateRigidBody(entityID, deltaTime);
+    if (!entityManager) return;
+
+    // Rigid bodies live in the archetype chunks; each job integrates whole chunks
+    auto view = entityManager->GetView<Transform, RigidBody>();
+    auto integrate = [&](EntityID, Transform& transform, RigidBody& rigidBody) {
+        UpdateRigidBody(transform, rigidBody, deltaTime);
+    };
+    if (!jobs) {
+        view.Each(integrate);
+        return;
     }
+    jobs->ParallelFor(view.GetChunkCount(), [&](size_t first, size_t last) {
+        view.EachInChunks(first, last, integrate);
+    });
 }
 
 void SimplePhysicsSystem::Shutdown() {
     std::cout << "Physics system shutdown" << std::endl;
-    rigidBodies.clear();
 }
 
-void SimplePhysicsSystem::AddRigidBody(EntityID entityID, const std::shared_ptr<RigidBody>& body) {
-    rigidBodies[entityID] = body;
+void SimplePhysicsSystem::AddRigidBody(EntityID entityID, const RigidBody& body) {
+    if (!entityManager) throw std::runtime_error("Physics system has no world!");
+    entityManager->AddComponent<RigidBody>(entityID, body);
     std::cout << "Rigid body added to entity " << entityID << std::endl;
 }
 
 void SimplePhysicsSystem::RemoveRigidBody(EntityID entityID) {
-    rigidBodies.erase(entityID);
+    if (!entityManager) throw std::runtime_error("Physics system has no world!");
+    entityManager->RemoveComponent<RigidBody>(entityID);
     std::cout << "Rigid body removed from entity " << entityID << std::endl;
 }
 
@@ -44,30 +56,22 @@ void SimplePhysicsSystem::Raycast(const glm::vec3& origin, const glm::vec3& dire
               << ") with max distance " << maxDistance << std::endl;
 }
 
-void SimplePhysicsSystem::UpdateRigidBody(EntityID entityID, float dt) {
-    auto entity = GetEngine().GetEntityManager().GetEntity(entityID);
-    if (!entity) return;
-
-    auto rigidBody = entity->GetComponent<RigidBody>();
-    auto transform = entity->GetComponent<Transform>();
-
-    if (!rigidBody || !transform) return;
-
-    if (!rigidBody->isKinematic) {
+void SimplePhysicsSystem::UpdateRigidBody(Transform& transform, RigidBody& rigidBody, float dt) {
+    if (!rigidBody.isKinematic) {
         // Apply gravity
-        if (rigidBody->useGravity) {
-            rigidBody->ApplyForce(gravity * rigidBody->mass);
+        if (rigidBody.useGravity) {
+            rigidBody.ApplyForce(gravity * rigidBody.mass);
         }
 
         // Update velocity based on acceleration
-        rigidBody->velocity += rigidBody->acceleration * dt;
-        rigidBody->acceleration = glm::vec3(0.0f);
+        rigidBody.velocity += rigidBody.acceleration * dt;
+        rigidBody.acceleration = glm::vec3(0.0f);
 
         // Apply drag
-        rigidBody->velocity *= 0.99f;
+        rigidBody.velocity *= 0.99f;
 
         // Update position
-        transform->position += rigidBody->velocity * dt;
+        transform.position += rigidBody.velocity * dt;
     }
 }
 
@@ -0,0 +1,214 @@
+#include "../include/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace Titan {
+
+// ============================================================================
+// Profiler Implementation
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const Clock::time_point s_epoch = Clock::now();
+
+// Written only by its thread; readers take the registry lock and rely on
+// the Profiler contract that nobody records meanwhile
+struct ThreadBuffer {
+    uint32_t threadId{0};
+    std::string name;
+    std::vector<Profiler::Event> events;  // sized on the first record
+    size_t capacity{0};
+    std::atomic<uint64_t> written{0};
+    bool retired{false};                  // its thread has exited
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    size_t capacity{1 << 16};
+    uint32_t nextThreadId{1};
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+// Registers the thread's buffer on first use and retires it on thread exit;
+// retired buffers stay readable until the next Clear
+struct LocalBuffer {
+    ThreadBuffer* buffer{nullptr};
+    uint32_t depth{0};
+
+    ThreadBuffer& Get() {
+        if (!buffer) {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto created = std::make_unique<ThreadBuffer>();
+            created->threadId = registry.nextThreadId++;
+            created->name = "Thread " + std::to_string(created->threadId);
+            created->capacity = registry.capacity;
+            buffer = created.get();
+            registry.buffers.push_back(std::move(created));
+        }
+        return *buffer;
+    }
+
+    ~LocalBuffer() {
+        if (!buffer) return;
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffer->retired = true;
+    }
+};
+
+thread_local LocalBuffer t_local;
+
+// Trivially destructible, so allocation hooks may read it during thread exit
+thread_local const char* t_zone = nullptr;
+
+void WriteJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) out << ' ';
+        else out << c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+std::atomic<bool> Profiler::enabled{false};
+
+uint32_t& Profiler::Depth() {
+    return t_local.depth;
+}
+
+const char*& Profiler::Zone() {
+    return t_zone;
+}
+
+void Profiler::SetBufferCapacity(size_t events) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.capacity = std::max<size_t>(1, events);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    ThreadBuffer& buffer = t_local.Get();
+    std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+    buffer.name = name;
+}
+
+uint64_t Profiler::Now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - s_epoch).count());
+}
+
+void Profiler::Record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth,
+                      const CounterSample* counters) {
+    ThreadBuffer& buffer = t_local.Get();
+    if (buffer.events.empty()) buffer.events.resize(buffer.capacity);
+
+    uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    Event& event = buffer.events[index % buffer.events.size()];
+    event.name = name;
+    event.startNs = startNs;
+    event.endNs = endNs;
+    event.depth = depth;
+    event.counters = counters ? *counters : CounterSample();
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::ThreadEvents> Profiler::Collect(uint64_t fromNs, uint64_t toNs) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<ThreadEvents> result;
+    for (const auto& buffer : registry.buffers) {
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        if (written == 0) continue;
+
+        size_t size = buffer->events.size();
+        size_t kept = static_cast<size_t>(std::min<uint64_t>(written, size));
+
+        ThreadEvents thread;
+        thread.threadId = buffer->threadId;
+        thread.threadName = buffer->name;
+        thread.dropped = written - kept;
+        for (uint64_t i = written - kept; i < written; ++i) {
+            const Event& event = buffer->events[i % size];
+            if (event.endNs > fromNs && event.startNs <= toNs) thread.events.push_back(event);
+        }
+        if (!thread.events.empty()) result.push_back(std::move(thread));
+    }
+    return result;
+}
+
+void Profiler::Clear() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.buffers.erase(std::remove_if(registry.buffers.begin(), registry.buffers.end(),
+                                          [](const std::unique_ptr<ThreadBuffer>& buffer) { return buffer->retired; }),
+                           registry.buffers.end());
+    for (auto& buffer : registry.buffers) {
+        buffer->written.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out) {
+    WriteChromeTrace(out, Collect());
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out, const std::vector<ThreadEvents>& threads) {
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Titan\"}}";
+    out << std::fixed << std::setprecision(3);
+
+    for (const ThreadEvents& thread : threads) {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.threadId
+            << ",\"args\":{\"name\":";
+        WriteJsonString(out, thread.threadName);
+        out << "}}";
+
+        // Complete events; viewers nest them by their time ranges
+        for (const Event& event : thread.events) {
+            out << ",\n{\"name\":";
+            WriteJsonString(out, event.name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread.threadId
+                << ",\"ts\":" << event.startNs / 1000.0
+                << ",\"dur\":" << (event.endNs - event.startNs) / 1000.0;
+            if (!event.counters.Empty()) {
+                out << ",\"args\":{";
+                const char* separator = "";
+                for (size_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) {
+                    HardwareCounter counter = static_cast<HardwareCounter>(i);
+                    if (!event.counters.Has(counter)) continue;
+                    out << separator << '"' << HardwareCounters::GetName(counter) << "\":" << event.counters.Get(counter);
+                    separator = ",";
+                }
+                if (event.counters.GetIPC() > 0.0) out << ",\"ipc\":" << event.counters.GetIPC();
+                out << "}";
+            }
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+    WriteChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+} // namespace Titan
@@ -0,0 +1,142 @@
+#include "../include/Scheduler.hpp"
+#include "../include/Profiler.hpp"
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace Titan {
+
+// ============================================================================
+// SystemScheduler Implementation
+// ============================================================================
+
+SystemScheduler::SystemScheduler(JobSystem& jobSystem)
+    : jobs(jobSystem) {
+}
+
+void SystemScheduler::SetSystems(const std::vector<ISystem*>& systems) {
+    nodes.clear();
+    nodes.resize(systems.size());
+
+    for (size_t i = 0; i < systems.size(); ++i) {
+        nodes[i].system = systems[i];
+        nodes[i].memoryTag = RegisterMemoryTag(systems[i]->GetName());
+        systems[i]->DeclareAccess(nodes[i].access);
+    }
+
+    // Registration order is the tie-breaker, so the graph is acyclic by construction
+    for (size_t j = 0; j < nodes.size(); ++j) {
+        for (size_t i = 0; i < j; ++i) {
+            if (nodes[i].access.ConflictsWith(nodes[j].access)) {
+                nodes[j].dependencies.push_back(i);
+                nodes[i].dependents.push_back(j);
+            }
+        }
+    }
+
+    pending.assign(nodes.size(), 0);
+
+    std::cout << "System scheduler: " << nodes.size() << " systems on "
+              << jobs.GetThreadCount() << " threads" << std::endl;
+}
+
+void SystemScheduler::Run(float deltaTime) {
+    // Registration order is a valid topological order
+    if (jobs.GetWorkerCount() == 0 || nodes.size() <= 1) {
+        for (auto& node : nodes) {
+            Update(node, deltaTime);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        frameDelta = deltaTime;
+        remaining = nodes.size();
+        firstError = nullptr;
+
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            pending[i] = nodes[i].dependencies.size();
+            if (pending[i] == 0) Dispatch(i);
+        }
+    }
+
+    // The calling thread works too: main-thread systems first, then any job
+    while (true) {
+        size_t index = 0;
+        bool haveMainSystem = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (remaining == 0) break;
+            if (!mainQueue.empty()) {
+                index = mainQueue.front();
+                mainQueue.pop_front();
+                haveMainSystem = true;
+            }
+        }
+
+        if (haveMainSystem) {
+            Execute(index);
+            Complete(index);
+        }
+        else if (!jobs.RunPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (firstError) {
+        std::exception_ptr error = firstError;
+        firstError = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void SystemScheduler::Execute(size_t index) {
+    try {
+        Update(nodes[index], frameDelta);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!firstError) firstError = std::current_exception();
+    }
+}
+
+void SystemScheduler::Update(Node& node, float deltaTime) {
+    TITAN_PROFILE_SCOPE(node.system->GetName());
+    MemoryTagScope tag(node.memoryTag);
+    CounterSample startCounters, endCounters;
+    bool counting = HardwareCounters::Read(startCounters);
+    auto start = std::chrono::steady_clock::now();
+    node.lastUpdateTime = 0.0f;
+    node.lastCounters = CounterSample();
+    node.system->Update(deltaTime);
+    node.lastUpdateTime = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    if (counting && HardwareCounters::Read(endCounters)) {
+        node.lastCounters = endCounters.Since(startCounters);
+    }
+}
+
+void SystemScheduler::Complete(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t dependent : nodes[index].dependents) {
+        if (--pending[dependent] == 0) {
+            Dispatch(dependent);
+        }
+    }
+    --remaining;
+}
+
+// Called with the mutex held
+void SystemScheduler::Dispatch(size_t index) {
+    if (nodes[index].access.IsMainThreadOnly()) {
+        mainQueue.push_back(index);
+        return;
+    }
+
+    jobs.Run([this, index]() {
+        Execute(index);
+        Complete(index);
+    });
+}
+
+} // namespace Titan
@@ -3,9 +3,19 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 
 namespace Titan {
 
+// Each lua_State carries the Engine that owns it in its extra space, so the
+// bindings stay correct with several engines in one process
+static Engine* GetScriptEngine(lua_State* L) {
+    Engine* engine = *static_cast<Engine**>(lua_getextraspace(L));
+    // Lua errors unwind with longjmp; a C++ exception must not cross the C core
+    if (!engine) luaL_error(L, "Lua state is not bound to an engine");
+    return engine;
+}
+
 // ============================================================================
 // LuaScriptingSystem Implementation
 // ============================================================================
@@ -19,6 +29,8 @@ void LuaScriptingSystem::Initialize() {
         return;
     }
 
+    *static_cast<Engine**>(lua_getextraspace(luaState)) = engine;
+
     // Load standard libraries
     luaL_openlibs(luaState);
 
@@ -117,17 +129,52 @@ void LuaScriptingSystem::UnloadMod(const std::string& modName) {
 void LuaScriptingSystem::RegisterEngineAPI() {
     // Engine functions
     lua_register(luaState, "GetTime", [](lua_State* L) -> int {
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         lua_pushnumber(L, engine.GetElapsedTime());
         return 1;
     });
 
     lua_register(luaState, "GetDeltaTime", [](lua_State* L) -> int {
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         lua_pushnumber(L, engine.GetDeltaTime());
         return 1;
     });
 
+    // PrintSystemTimes([count [, frames]]): most expensive systems lately
+    lua_register(luaState, "PrintSystemTimes", [](lua_State* L) -> int {
+        auto& engine = *GetScriptEngine(L);
+        size_t count = lua_gettop(L) >= 1 && lua_isinteger(L, 1) ? static_cast<size_t>(lua_tointeger(L, 1)) : 5;
+        size_t frames = lua_gettop(L) >= 2 && lua_isinteger(L, 2) ? static_cast<size_t>(lua_tointeger(L, 2)) : 0;
+        engine.GetPerformanceMonitor().PrintTopSystems(std::cout, count, frames);
+        return 0;
+    });
+
+    // EnableHardwareCounters(on): returns whether this thread has any counter
+    lua_register(luaState, "EnableHardwareCounters", [](lua_State* L) -> int {
+        bool enable = lua_gettop(L) < 1 || lua_toboolean(L, 1);
+        HardwareCounters::SetEnabled(enable);
+        bool available = HardwareCounters::GetAvailableMask() != 0;
+        if (enable && !available) {
+            std::cout << "Hardware counters unavailable: " << HardwareCounters::GetStatus() << std::endl;
+        }
+        lua_pushboolean(L, available);
+        return 1;
+    });
+
+    // WriteFrameStats(path [, frames]): frame history as CSV
+    lua_register(luaState, "WriteFrameStats", [](lua_State* L) -> int {
+        if (lua_gettop(L) < 1 || !lua_isstring(L, 1)) {
+            lua_pushboolean(L, false);
+            return 1;
+        }
+        auto& engine = *GetScriptEngine(L);
+        size_t frames = lua_gettop(L) >= 2 && lua_isinteger(L, 2) ? static_cast<size_t>(lua_tointeger(L, 2)) : 0;
+        std::ofstream file(lua_tostring(L, 1));
+        if (file) engine.GetPerformanceMonitor().WriteFrameStatsCsv(file, frames);
+        lua_pushboolean(L, static_cast<bool>(file));
+        return 1;
+    });
+
     lua_register(luaState, "Print", [](lua_State* L) -> int {
         int argc = lua_gettop(L);
         for (int i = 1; i <= argc; ++i) {
@@ -145,7 +192,7 @@ void LuaScriptingSystem::RegisterEngineAPI() {
 void LuaScriptingSystem::RegisterEntityAPI() {
     // Entity management functions
     lua_register(luaState, "CreateEntity", [](lua_State* L) -> int {
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         Titan::EntityID entityId = engine.GetEntityManager().CreateEntity();
         lua_pushinteger(L, static_cast<lua_Integer>(entityId));
         return 1;
@@ -156,16 +203,31 @@ void LuaScriptingSystem::RegisterEntityAPI() {
             lua_pushboolean(L, false);
             return 1;
         }
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         Titan::EntityID entityId = static_cast<Titan::EntityID>(lua_tointeger(L, 1));
-        engine.GetEntityManager().DestroyEntity(entityId);
-        lua_pushboolean(L, true);
+        auto& entityManager = engine.GetEntityManager();
+        // Stale handles (already destroyed, slot reused) report false. The entity
+        // is removed at the end of the frame, so scripts may keep iterating.
+        bool alive = entityManager.IsAlive(entityId);
+        entityManager.GetCommandBuffer().DestroyEntity(entityId);
+        lua_pushboolean(L, alive);
+        return 1;
+    });
+
+    lua_register(luaState, "IsEntityValid", [](lua_State* L) -> int {
+        if (lua_gettop(L) < 1 || !lua_isinteger(L, 1)) {
+            lua_pushboolean(L, false);
+            return 1;
+        }
+        auto& engine = *GetScriptEngine(L);
+        Titan::EntityID entityId = static_cast<Titan::EntityID>(lua_tointeger(L, 1));
+        lua_pushboolean(L, engine.GetEntityManager().IsAlive(entityId));
         return 1;
     });
 
     lua_register(luaState, "GetEntityCount", [](lua_State* L) -> int {
-        auto& engine = GetEngine();
-        size_t count = engine.GetEntityManager().GetAllEntities().size();
+        auto& engine = *GetScriptEngine(L);
+        size_t count = engine.GetEntityManager().GetEntityCount();
         lua_pushinteger(L, static_cast<lua_Integer>(count));
         return 1;
     });
@@ -199,7 +261,7 @@ void LuaScriptingSystem::RegisterInputAPI() {
             lua_pushboolean(L, false);
             return 1;
         }
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         int keyCode = static_cast<int>(lua_tointeger(L, 1));
         bool pressed = engine.GetInputSystem().IsKeyPressed(static_cast<Titan::KeyCode>(keyCode));
         lua_pushboolean(L, pressed);
@@ -211,7 +273,7 @@ void LuaScriptingSystem::RegisterInputAPI() {
             lua_pushboolean(L, false);
             return 1;
         }
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         int button = static_cast<int>(lua_tointeger(L, 1));
         bool pressed = engine.GetInputSystem().IsMouseButtonPressed(static_cast<Titan::MouseButton>(button));
         lua_pushboolean(L, pressed);
@@ -219,7 +281,7 @@ void LuaScriptingSystem::RegisterInputAPI() {
     });
 
     lua_register(luaState, "GetMousePosition", [](lua_State* L) -> int {
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         float x, y;
         engine.GetInputSystem().GetMousePosition(x, y);
         lua_pushnumber(L, x);
@@ -257,7 +319,7 @@ void LuaScriptingSystem::RegisterPhysicsAPI() {
             lua_pushboolean(L, false);
             return 1;
         }
-        auto& engine = GetEngine();
+        auto& engine = *GetScriptEngine(L);
         float x = static_cast<float>(lua_tonumber(L, 1));
         float y = static_cast<float>(lua_tonumber(L, 2));
         float z = static_cast<float>(lua_tonumber(L, 3));
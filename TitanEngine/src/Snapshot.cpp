@@ -0,0 +1,274 @@
+#include "../include/Snapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+namespace Titan {
+
+static constexpr size_t SNAPSHOT_ALIGNMENT = 64;
+
+// ============================================================================
+// WorldSnapshot Implementation
+// ============================================================================
+
+WorldSnapshot::~WorldSnapshot() {
+    Reset();
+}
+
+void WorldSnapshot::Reset() {
+    DestroyStoredComponents();
+    ::operator delete(buffer, std::align_val_t{SNAPSHOT_ALIGNMENT});
+    buffer = nullptr;
+    bufferSize = 0;
+    bufferCapacity = 0;
+
+    archetypes.clear();
+    segments.clear();
+    slots.clear();
+    names.clear();
+    gameState.clear();
+    captured = false;
+    ownerSerial = 0;
+    stats = Stats();
+}
+
+void WorldSnapshot::Capture(EntityManager& world) {
+    if (captured && MatchesLayout(world)) {
+        CopyColumns(false, true);
+        stats.delta = true;
+    } else {
+        CaptureFull(world);
+        stats.delta = false;
+    }
+    capturedVersion = world.AdvanceChangeVersion();
+}
+
+void WorldSnapshot::Restore(EntityManager& world) {
+    if (!captured) {
+        throw std::runtime_error("Restore of a snapshot that was never captured");
+    }
+
+    if (MatchesLayout(world)) {
+        CopyColumns(true, true);
+        stats.delta = true;
+    } else {
+        RestoreFull(world);
+        stats.delta = false;
+    }
+    // The world now equals the snapshot; later writes get newer versions
+    capturedVersion = world.AdvanceChangeVersion();
+}
+
+bool WorldSnapshot::MatchesLayout(const EntityManager& world) const {
+    return ownerSerial == world.serial && layoutVersion == world.structuralVersion;
+}
+
+void WorldSnapshot::CaptureFull(EntityManager& world) {
+    for (const auto& archetype : world.archetypes) {
+        for (const ComponentTypeInfo& type : archetype->types) {
+            if (archetype->entityCount > 0 && !type.plain && !type.copyConstruct) {
+                throw std::runtime_error("Component " + std::to_string(type.id) + " cannot be copied into a snapshot");
+            }
+        }
+    }
+
+    DestroyStoredComponents();
+    archetypes.clear();
+
+    // Lay out one segment per chunk column
+    size_t offset = 0;
+    for (const auto& archetype : world.archetypes) {
+        if (archetype->entityCount == 0) continue;
+
+        uint32_t index = static_cast<uint32_t>(archetypes.size());
+        archetypes.push_back(ArchetypeState{ archetype->types, archetype->entityCount, archetype.get() });
+
+        for (size_t c = 0; c < archetype->chunks.size() && archetype->chunks[c].count > 0; ++c) {
+            Segment segment;
+            segment.archetype = index;
+            segment.chunk = static_cast<uint32_t>(c);
+            segment.count = archetype->chunks[c].count;
+            segment.column = -1;
+            segment.offset = offset;
+            segments.push_back(segment);
+            offset += sizeof(EntityID) * segment.count;
+
+            for (size_t column = 0; column < archetype->types.size(); ++column) {
+                const ComponentTypeInfo& type = archetype->types[column];
+                offset = (offset + type.alignment - 1) & ~(type.alignment - 1);
+                segment.column = static_cast<int32_t>(column);
+                segment.offset = offset;
+                segments.push_back(segment);
+                offset += type.size * segment.count;
+            }
+        }
+    }
+
+    if (offset > bufferCapacity) {
+        ::operator delete(buffer, std::align_val_t{SNAPSHOT_ALIGNMENT});
+        buffer = static_cast<uint8_t*>(::operator new(offset, std::align_val_t{SNAPSHOT_ALIGNMENT}));
+        bufferCapacity = offset;
+    }
+    bufferSize = offset;
+
+    stats.copiedBytes = 0;
+    for (const Segment& segment : segments) {
+        Archetype* live = archetypes[segment.archetype].live;
+        const Archetype::Chunk& chunk = live->chunks[segment.chunk];
+        if (segment.column < 0) {
+            std::memcpy(SegmentData(segment), live->GetEntities(chunk), sizeof(EntityID) * segment.count);
+            continue;
+        }
+
+        const ComponentTypeInfo& type = live->types[segment.column];
+        const uint8_t* source = static_cast<const uint8_t*>(live->GetColumn(chunk, segment.column));
+        if (type.plain) {
+            std::memcpy(SegmentData(segment), source, type.size * segment.count);
+        } else {
+            for (uint32_t i = 0; i < segment.count; ++i) {
+                type.copyConstruct(SegmentData(segment) + type.size * i, source + type.size * i);
+            }
+        }
+        stats.copiedBytes += type.size * segment.count;
+    }
+
+    // Entity table; free slots keep no name
+    slots.resize(world.slots.size());
+    names.clear();
+    for (size_t i = 0; i < world.slots.size(); ++i) {
+        const EntityRecord& record = world.slots[i];
+        SlotState& state = slots[i];
+        state.archetype = NO_ARCHETYPE;
+        state.row = record.row;
+        state.generation = record.generation;
+        state.nextFree = record.nextFree;
+        state.active = record.active;
+        state.nameOffset = static_cast<uint32_t>(names.size());
+        state.nameLength = record.archetype ? static_cast<uint32_t>(record.name.size()) : 0;
+        if (record.archetype) names += record.name;
+    }
+    for (const Segment& segment : segments) {
+        if (segment.column >= 0) continue;
+        const EntityID* entities = reinterpret_cast<const EntityID*>(SegmentData(segment));
+        for (uint32_t i = 0; i < segment.count; ++i) {
+            slots[GetEntityIndex(entities[i])].archetype = segment.archetype;
+        }
+    }
+    freeHead = world.freeHead;
+    freeTail = world.freeTail;
+    entityCount = world.entityCount;
+
+    captured = true;
+    ownerSerial = world.serial;
+    layoutVersion = world.structuralVersion;
+    stats.bufferBytes = bufferSize + names.size() + slots.size() * sizeof(SlotState);
+}
+
+void WorldSnapshot::RestoreFull(EntityManager& world) {
+    // Empty every archetype, then give back the chunks of those the snapshot does not use
+    for (auto& archetype : world.archetypes) {
+        archetype->DestroyAll();
+    }
+    for (ArchetypeState& state : archetypes) {
+        state.live = world.GetOrCreateArchetype(state.types);
+    }
+    for (auto& archetype : world.archetypes) {
+        bool used = std::any_of(archetypes.begin(), archetypes.end(),
+                                [&archetype](const ArchetypeState& state) { return state.live == archetype.get(); });
+        if (!used) archetype->ResizeRows(0);
+    }
+    for (ArchetypeState& state : archetypes) {
+        state.live->ResizeRows(state.entityCount);
+    }
+
+    stats.copiedBytes = 0;
+    for (const Segment& segment : segments) {
+        Archetype* live = archetypes[segment.archetype].live;
+        const Archetype::Chunk& chunk = live->chunks[segment.chunk];
+        if (segment.column < 0) {
+            std::memcpy(live->GetEntities(chunk), SegmentData(segment), sizeof(EntityID) * segment.count);
+            continue;
+        }
+
+        const ComponentTypeInfo& type = live->types[segment.column];
+        uint8_t* target = static_cast<uint8_t*>(live->GetColumn(chunk, segment.column));
+        if (type.plain) {
+            std::memcpy(target, SegmentData(segment), type.size * segment.count);
+        } else {
+            for (uint32_t i = 0; i < segment.count; ++i) {
+                type.copyConstruct(target + type.size * i, SegmentData(segment) + type.size * i);
+            }
+        }
+        stats.copiedBytes += type.size * segment.count;
+    }
+
+    world.slots.resize(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        EntityRecord& record = world.slots[i];
+        const SlotState& state = slots[i];
+        record.name.assign(names, state.nameOffset, state.nameLength);
+        record.active = state.active;
+        record.archetype = state.archetype == NO_ARCHETYPE ? nullptr : archetypes[state.archetype].live;
+        record.row = state.row;
+        record.generation = state.generation;
+        record.nextFree = state.nextFree;
+    }
+    world.freeHead = freeHead;
+    world.freeTail = freeTail;
+    world.entityCount = entityCount;
+
+    // Pending commands refer to the replaced world
+    {
+        std::lock_guard<std::mutex> lock(world.commandBufferMutex);
+        for (auto& commands : world.commandBuffers) {
+            commands->Clear();
+        }
+    }
+
+    ++world.structuralVersion;
+    ownerSerial = world.serial;
+    layoutVersion = world.structuralVersion;
+}
+
+// Copies chunk columns between the buffer and the live archetypes of a world
+// whose layout matches; onlyChanged skips columns untouched since capturedVersion
+void WorldSnapshot::CopyColumns(bool toWorld, bool onlyChanged) {
+    stats.copiedBytes = 0;
+    for (const Segment& segment : segments) {
+        if (segment.column < 0) continue;
+
+        Archetype* live = archetypes[segment.archetype].live;
+        if (onlyChanged && live->GetChangedVersion(segment.chunk, segment.column) <= capturedVersion) continue;
+
+        const ComponentTypeInfo& type = live->types[segment.column];
+        uint8_t* current = static_cast<uint8_t*>(live->GetColumn(live->chunks[segment.chunk], segment.column));
+        uint8_t* stored = SegmentData(segment);
+        uint8_t* target = toWorld ? current : stored;
+        const uint8_t* source = toWorld ? stored : current;
+
+        if (type.plain) {
+            std::memcpy(target, source, type.size * segment.count);
+        } else {
+            for (uint32_t i = 0; i < segment.count; ++i) {
+                type.copyAssign(target + type.size * i, source + type.size * i);
+            }
+        }
+        if (toWorld) live->MarkChanged(segment.chunk, segment.column);
+        stats.copiedBytes += type.size * segment.count;
+    }
+}
+
+void WorldSnapshot::DestroyStoredComponents() {
+    for (const Segment& segment : segments) {
+        if (segment.column < 0) continue;
+        const ComponentTypeInfo& type = archetypes[segment.archetype].types[segment.column];
+        if (type.plain) continue;
+        for (uint32_t i = 0; i < segment.count; ++i) {
+            type.destroy(SegmentData(segment) + type.size * i);
+        }
+    }
+    segments.clear();
+}
+
+} // namespace Titan
@@ -0,0 +1,308 @@
+#include "../include/Telemetry.hpp"
+#include "../include/Networking.hpp"
+#include "../include/Performance.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Titan {
+
+// ============================================================================
+// Shared Segment Layout
+// ============================================================================
+
+static constexpr uint32_t TELEMETRY_MAGIC = 0x4D4C4554;  // "TELM"
+static constexpr size_t FRAME_WORDS = sizeof(TelemetryFrame) / sizeof(uint64_t);
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory needs address-free atomics");
+
+// Seqlock: sequence is 2n+1 while frame n is written and 2n+2 once it is
+// complete. The frame is stored as relaxed atomic words so a reader racing
+// the writer gets a torn copy it then discards, never undefined behavior.
+struct TelemetrySlot {
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> words[FRAME_WORDS];
+};
+
+struct alignas(64) TelemetrySegment {
+    std::atomic<uint32_t> magic;      // stored last when a publisher opens
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t frameBytes;
+    std::atomic<uint64_t> published;
+    std::atomic<uint32_t> systemCount;  // names below are written before it grows
+    char systemNames[TELEMETRY_MAX_SYSTEMS][TELEMETRY_NAME_LENGTH];
+
+    TelemetrySlot* GetSlots() { return reinterpret_cast<TelemetrySlot*>(this + 1); }
+    const TelemetrySlot* GetSlots() const { return reinterpret_cast<const TelemetrySlot*>(this + 1); }
+
+    static size_t GetBytes(uint32_t capacity) { return sizeof(TelemetrySegment) + capacity * sizeof(TelemetrySlot); }
+};
+
+static std::string GetSegmentPath(const std::string& name) {
+#ifdef _WIN32
+    return "Local\\titan-" + name;
+#else
+    return "/titan-" + name;
+#endif
+}
+
+static void Unmap(const void* address, size_t bytes, void* handle) {
+    if (!address) return;
+#ifdef _WIN32
+    (void)bytes;
+    UnmapViewOfFile(address);
+    if (handle) CloseHandle(handle);
+#else
+    (void)handle;
+    munmap(const_cast<void*>(address), bytes);
+#endif
+}
+
+// ============================================================================
+// TelemetryPublisher Implementation
+// ============================================================================
+
+TelemetryPublisher::~TelemetryPublisher() {
+    Close();
+}
+
+bool TelemetryPublisher::Open(const std::string& name, uint32_t capacity) {
+    Close();
+    capacity = std::max(1u, capacity);
+    size_t bytes = TelemetrySegment::GetBytes(capacity);
+    std::string path = GetSegmentPath(name);
+
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(static_cast<uint64_t>(bytes) >> 32),
+                                        static_cast<DWORD>(bytes), path.c_str());
+    if (!mapping) return false;
+    void* memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+    if (!memory) {
+        CloseHandle(mapping);
+        return false;
+    }
+    mappingHandle = mapping;
+#else
+    int fd = shm_open(path.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) return false;
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        close(fd);
+        return false;
+    }
+    void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) return false;
+#endif
+
+    // A segment left by a previous run is reset; its readers see the new magic order
+    std::memset(memory, 0, bytes);
+    segment = new (memory) TelemetrySegment();
+    for (uint32_t i = 0; i < capacity; ++i) {
+        new (&segment->GetSlots()[i]) TelemetrySlot();
+    }
+    segment->version = TELEMETRY_VERSION;
+    segment->capacity = capacity;
+    segment->frameBytes = sizeof(TelemetryFrame);
+    segment->magic.store(TELEMETRY_MAGIC, std::memory_order_release);
+
+    mappedBytes = bytes;
+    segmentName = path;
+    published = 0;
+    systemNames = 0;
+    return true;
+}
+
+void TelemetryPublisher::Close() {
+    if (!segment) return;
+    Unmap(segment, mappedBytes, mappingHandle);
+#ifndef _WIN32
+    shm_unlink(segmentName.c_str());
+#endif
+    segment = nullptr;
+    mappedBytes = 0;
+    mappingHandle = nullptr;
+}
+
+void TelemetryPublisher::Publish(TelemetryFrame frame) {
+    if (!segment) return;
+    frame.frameIndex = published;
+    frame.timestampNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
+    uint64_t words[FRAME_WORDS];
+    std::memcpy(words, &frame, sizeof(frame));
+
+    TelemetrySlot& slot = segment->GetSlots()[published % segment->capacity];
+    slot.sequence.store(2 * published + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < FRAME_WORDS; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(2 * published + 2, std::memory_order_release);
+
+    ++published;
+    segment->published.store(published, std::memory_order_release);
+}
+
+void TelemetryPublisher::Publish(const PerformanceMonitor& monitor, const NetworkStats* network,
+                                 uint32_t connectedPlayers) {
+    if (!segment) return;
+    TelemetryFrame frame;
+
+    const auto& history = monitor.GetFrameHistory();
+    if (!history.Empty()) {
+        const PerformanceMonitor::FrameStats& stats = history.Back();
+        frame.deltaTime = stats.deltaTime;
+        frame.workTime = stats.workTime;
+        frame.renderTime = stats.renderTime;
+        frame.physicsTime = stats.physicsTime;
+        frame.scriptTime = stats.scriptTime;
+        frame.entityCount = stats.entityCount;
+        frame.renderedEntities = stats.renderedEntities;
+        frame.scratchBytes = stats.scratchBytes;
+        frame.allocations = stats.allocations;
+        frame.allocatedBytes = stats.allocatedBytes;
+    }
+    if (network) {
+        frame.messagesSent = network->messagesSent;
+        frame.messagesReceived = network->messagesReceived;
+        frame.bytesSent = network->bytesSent;
+        frame.bytesReceived = network->bytesReceived;
+    }
+    frame.connectedPlayers = connectedPlayers;
+
+    // New systems get their names published before any frame refers to them
+    uint32_t count = static_cast<uint32_t>(std::min<size_t>(monitor.GetSystemCount(), TELEMETRY_MAX_SYSTEMS));
+    for (; systemNames < count; ++systemNames) {
+        char* name = segment->systemNames[systemNames];
+        std::strncpy(name, monitor.GetSystemName(systemNames), TELEMETRY_NAME_LENGTH - 1);
+        name[TELEMETRY_NAME_LENGTH - 1] = '\0';
+        segment->systemCount.store(systemNames + 1, std::memory_order_release);
+    }
+    frame.systemCount = count;
+    for (uint32_t i = 0; i < count; ++i) {
+        frame.systemTimes[i] = monitor.GetLastSystemTime(i);
+    }
+
+    Publish(frame);
+}
+
+// ============================================================================
+// TelemetryReader Implementation
+// ============================================================================
+
+TelemetryReader::~TelemetryReader() {
+    Close();
+}
+
+bool TelemetryReader::Open(const std::string& name) {
+    Close();
+    std::string path = GetSegmentPath(name);
+    const void* memory = nullptr;
+    size_t bytes = 0;
+
+#ifdef _WIN32
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, path.c_str());
+    if (!mapping) return false;
+    memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION info;
+    if (!memory || !VirtualQuery(memory, &info, sizeof(info))) {
+        if (memory) UnmapViewOfFile(memory);
+        CloseHandle(mapping);
+        return false;
+    }
+    bytes = info.RegionSize;
+    mappingHandle = mapping;
+#else
+    int fd = shm_open(path.c_str(), O_RDONLY, 0);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(TelemetrySegment)) {
+        close(fd);
+        return false;
+    }
+    bytes = static_cast<size_t>(info.st_size);
+    memory = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) return false;
+#endif
+
+    const TelemetrySegment* candidate = static_cast<const TelemetrySegment*>(memory);
+    bool valid = candidate->magic.load(std::memory_order_acquire) == TELEMETRY_MAGIC &&
+                 candidate->version == TELEMETRY_VERSION && candidate->frameBytes == sizeof(TelemetryFrame) &&
+                 TelemetrySegment::GetBytes(candidate->capacity) <= bytes;
+    if (!valid) {
+        Unmap(memory, bytes, mappingHandle);
+        mappingHandle = nullptr;
+        return false;
+    }
+    segment = candidate;
+    mappedBytes = bytes;
+    return true;
+}
+
+void TelemetryReader::Close() {
+    if (!segment) return;
+    Unmap(segment, mappedBytes, mappingHandle);
+    segment = nullptr;
+    mappedBytes = 0;
+    mappingHandle = nullptr;
+}
+
+uint32_t TelemetryReader::GetCapacity() const {
+    return segment ? segment->capacity : 0;
+}
+
+uint64_t TelemetryReader::GetPublishedCount() const {
+    return segment ? segment->published.load(std::memory_order_acquire) : 0;
+}
+
+bool TelemetryReader::ReadFrame(uint64_t frameIndex, TelemetryFrame& out) const {
+    if (!segment) return false;
+    const TelemetrySlot& slot = segment->GetSlots()[frameIndex % segment->capacity];
+
+    uint64_t expected = 2 * frameIndex + 2;
+    if (slot.sequence.load(std::memory_order_acquire) != expected) return false;
+    uint64_t words[FRAME_WORDS];
+    for (size_t i = 0; i < FRAME_WORDS; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != expected) return false;
+
+    std::memcpy(&out, words, sizeof(out));
+    return true;
+}
+
+bool TelemetryReader::ReadLatest(TelemetryFrame& out) const {
+    // Retry while the writer laps the newest slot
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        uint64_t count = GetPublishedCount();
+        if (count == 0) return false;
+        if (ReadFrame(count - 1, out)) return true;
+    }
+    return false;
+}
+
+uint32_t TelemetryReader::GetSystemCount() const {
+    return segment ? std::min(segment->systemCount.load(std::memory_order_acquire), TELEMETRY_MAX_SYSTEMS) : 0;
+}
+
+const char* TelemetryReader::GetSystemName(uint32_t index) const {
+    return segment && index < GetSystemCount() ? segment->systemNames[index] : "";
+}
+
+} // namespace Titan
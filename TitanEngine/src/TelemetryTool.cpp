@@ -0,0 +1,161 @@
+// Reads the live telemetry a running engine publishes (EngineConfig::
+// telemetryName) and prints it as a refreshing table, or dumps the frames
+// still held in the ring as CSV.
+//
+// usage: TitanTelemetry <name> [--interval ms] [--top n]
+//        TitanTelemetry <name> --csv [--frames n]
+
+#include "../include/Telemetry.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Titan;
+
+// Frames published after index from, oldest first, skipping any the writer overwrote
+static std::vector<TelemetryFrame> ReadSince(const TelemetryReader& reader, uint64_t from, uint64_t to) {
+    uint64_t capacity = reader.GetCapacity();
+    if (to > capacity && from < to - capacity) from = to - capacity;
+
+    std::vector<TelemetryFrame> frames;
+    TelemetryFrame frame;
+    for (uint64_t index = from; index < to; ++index) {
+        if (reader.ReadFrame(index, frame)) frames.push_back(frame);
+    }
+    return frames;
+}
+
+static int DumpCsv(const TelemetryReader& reader, uint64_t limit) {
+    uint64_t published = reader.GetPublishedCount();
+    uint64_t from = limit > 0 && published > limit ? published - limit : 0;
+    std::vector<TelemetryFrame> frames = ReadSince(reader, from, published);
+    uint32_t systems = reader.GetSystemCount();
+
+    std::cout << "frame,timestamp_ns,frame_ms,work_ms,render_ms,physics_ms,script_ms,entities,rendered,players,"
+                 "scratch_bytes,allocations,allocated_bytes,messages_sent,messages_received,bytes_sent,bytes_received";
+    for (uint32_t i = 0; i < systems; ++i) std::cout << "," << reader.GetSystemName(i) << "_ms";
+    std::cout << "\n";
+
+    for (const TelemetryFrame& f : frames) {
+        std::cout << f.frameIndex << "," << f.timestampNs << ","
+                  << f.deltaTime * 1000.0f << "," << f.workTime * 1000.0f << "," << f.renderTime * 1000.0f << ","
+                  << f.physicsTime * 1000.0f << "," << f.scriptTime * 1000.0f << ","
+                  << f.entityCount << "," << f.renderedEntities << "," << f.connectedPlayers << ","
+                  << f.scratchBytes << "," << f.allocations << "," << f.allocatedBytes << ","
+                  << f.messagesSent << "," << f.messagesReceived << "," << f.bytesSent << "," << f.bytesReceived;
+        for (uint32_t i = 0; i < systems; ++i) {
+            std::cout << ",";
+            if (i < f.systemCount) std::cout << f.systemTimes[i] * 1000.0f;
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}
+
+// One refresh: averages over the frames published since the last one
+static void PrintTable(const TelemetryReader& reader, const std::vector<TelemetryFrame>& frames,
+                       const TelemetryFrame& previous, size_t top) {
+    const TelemetryFrame& latest = frames.back();
+    double frameSum = 0.0, workSum = 0.0, worst = 0.0;
+    std::vector<double> systemSums(TELEMETRY_MAX_SYSTEMS, 0.0);
+    for (const TelemetryFrame& f : frames) {
+        frameSum += f.deltaTime;
+        workSum += f.workTime;
+        worst = std::max(worst, static_cast<double>(f.deltaTime));
+        for (uint32_t i = 0; i < f.systemCount; ++i) systemSums[i] += f.systemTimes[i];
+    }
+    double count = static_cast<double>(frames.size());
+    double seconds = (latest.timestampNs - previous.timestampNs) / 1e9;
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "frame " << latest.frameIndex << "  fps " << (frameSum > 0.0 ? count / frameSum : 0.0)
+              << "  frame " << frameSum / count * 1000.0 << " ms (max " << worst * 1000.0 << ")"
+              << "  work " << workSum / count * 1000.0 << " ms\n"
+              << "entities " << latest.entityCount << "  rendered " << latest.renderedEntities
+              << "  allocs/frame " << latest.allocations << "  scratch " << latest.scratchBytes / 1024 << " KB\n";
+    if (seconds > 0.0) {
+        std::cout << "network  players " << latest.connectedPlayers << "  msgs/s out "
+                  << (latest.messagesSent - previous.messagesSent) / seconds << " in "
+                  << (latest.messagesReceived - previous.messagesReceived) / seconds << "  KB/s out "
+                  << (latest.bytesSent - previous.bytesSent) / seconds / 1024.0 << " in "
+                  << (latest.bytesReceived - previous.bytesReceived) / seconds / 1024.0 << "\n";
+    }
+
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < std::min(latest.systemCount, reader.GetSystemCount()); ++i) order.push_back(i);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return systemSums[a] > systemSums[b]; });
+    if (order.size() > top) order.resize(top);
+    for (uint32_t i : order) {
+        std::cout << "  " << std::left << std::setw(16) << reader.GetSystemName(i) << std::right
+                  << std::setw(9) << std::setprecision(3) << systemSums[i] / count * 1000.0 << " ms\n";
+    }
+    std::cout << std::defaultfloat << std::endl;
+}
+
+static int Watch(TelemetryReader& reader, const std::string& name, int intervalMs, size_t top) {
+    uint64_t seen = reader.GetPublishedCount();
+    TelemetryFrame previous;
+    reader.ReadLatest(previous);
+    int idle = 0;
+
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+        uint64_t published = reader.GetPublishedCount();
+        std::vector<TelemetryFrame> frames = ReadSince(reader, seen, published);
+        seen = published;
+
+        if (frames.empty()) {
+            // A restarted engine creates a fresh segment; our mapping is the old one
+            if (++idle * intervalMs >= 2000) {
+                idle = 0;
+                if (reader.Open(name)) {
+                    seen = reader.GetPublishedCount();
+                    reader.ReadLatest(previous);
+                } else {
+                    std::cout << "waiting for '" << name << "'..." << std::endl;
+                }
+            }
+            continue;
+        }
+        idle = 0;
+        PrintTable(reader, frames, previous, top);
+        previous = frames.back();
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argv[1][0] == '-') {
+        std::cerr << "usage: TitanTelemetry <name> [--interval ms] [--top n] [--csv [--frames n]]\n";
+        return 2;
+    }
+    std::string name = argv[1];
+    int intervalMs = 1000;
+    size_t top = 8;
+    bool csv = false;
+    uint64_t frames = 0;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--interval" && hasValue) intervalMs = std::max(10, std::atoi(argv[++i]));
+        else if (arg == "--top" && hasValue) top = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        else if (arg == "--frames" && hasValue) frames = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--csv") csv = true;
+        else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            return 2;
+        }
+    }
+
+    TelemetryReader reader;
+    if (!reader.Open(name)) {
+        std::cerr << "No telemetry segment named '" << name << "' (is the engine running with telemetryName set?)\n";
+        return 1;
+    }
+    return csv ? DumpCsv(reader, frames) : Watch(reader, name, intervalMs, top);
+}
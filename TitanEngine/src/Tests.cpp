@@ -1,9 +1,37 @@
 #include "../include/TestFramework.hpp"
 #include "../include/Core.hpp"
+#include "../include/Engine.hpp"
 #include "../include/Renderer.hpp"
 #include "../include/TitanEditor.hpp"
 #include "../include/Networking.hpp"
+#include "../include/Scheduler.hpp"
+#include "../include/Jobs.hpp"
+#include "../include/Input.hpp"
+#include "../include/Gamemodes.hpp"
+#include "../include/Performance.hpp"
+#include "../include/Memory.hpp"
+#include "../include/Hierarchy.hpp"
+#include "../include/TransformBatch.hpp"
+#include "../include/Timing.hpp"
+#include "../include/Physics.hpp"
+#include "../include/Snapshot.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/HardwareCounters.hpp"
+#include "../include/Telemetry.hpp"
+#if !defined(_WIN32) || defined(TITAN_STATIC)
+#include "../include/AllocationHooks.hpp"
+#endif
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 using namespace Titan;
 using namespace Titan::Test;
@@ -17,8 +45,8 @@ REGISTER_TEST(EntityManager_CreateEntity) {
     auto id = em.CreateEntity("TestEntity");
     ASSERT(id != 0);
     auto entity = em.GetEntity(id);
-    ASSERT_NOT_NULL(entity.get());
-    ASSERT_STR_EQ(entity->GetName(), "TestEntity");
+    ASSERT(entity.IsValid());
+    ASSERT_STR_EQ(entity.GetName(), "TestEntity");
 }
 
 REGISTER_TEST(EntityManager_DestroyEntity) {
@@ -26,28 +54,594 @@ REGISTER_TEST(EntityManager_DestroyEntity) {
     auto id = em.CreateEntity("ToDestroy");
     em.DestroyEntity(id);
     auto entity = em.GetEntity(id);
-    ASSERT_NULL(entity.get());
+    ASSERT(!entity.IsValid());
 }
 
 REGISTER_TEST(Entity_AddComponent) {
-    Entity e(1, "TestEntity");
-    auto transform = std::make_shared<Transform>(glm::vec3(1.0f, 2.0f, 3.0f));
-    e.AddComponent(transform);
+    EntityManager em;
+    Entity e = em.GetEntity(em.CreateEntity("TestEntity"));
+    e.AddComponent<Transform>(glm::vec3(1.0f, 2.0f, 3.0f));
     ASSERT(e.HasComponent<Transform>());
     auto retrieved = e.GetComponent<Transform>();
-    ASSERT_NOT_NULL(retrieved.get());
+    ASSERT_NOT_NULL(retrieved);
     ASSERT_EQ(retrieved->position.x, 1.0f);
 }
 
 REGISTER_TEST(Entity_RemoveComponent) {
-    Entity e(1, "TestEntity");
-    auto transform = std::make_shared<Transform>();
-    e.AddComponent(transform);
+    EntityManager em;
+    Entity e = em.GetEntity(em.CreateEntity("TestEntity"));
+    e.AddComponent<Transform>();
     ASSERT(e.HasComponent<Transform>());
     e.RemoveComponent<Transform>();
     ASSERT(!e.HasComponent<Transform>());
 }
 
+REGISTER_TEST(EntityManager_StaleHandle) {
+    EntityManager em;
+    auto first = em.CreateEntity("First");
+    em.AddComponent<Transform>(first);
+    em.DestroyEntity(first);
+
+    // The slot is reused with a new generation; the old handle stays dead
+    auto second = em.CreateEntity("Second");
+    ASSERT(GetEntityIndex(first) == GetEntityIndex(second));
+    ASSERT(first != second);
+    ASSERT(!em.IsAlive(first));
+    ASSERT(em.IsAlive(second));
+    ASSERT_NULL(em.GetComponent<Transform>(first));
+    em.DestroyEntity(first);
+    ASSERT(em.IsAlive(second));
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 1);
+}
+
+REGISTER_TEST(EntityManager_ArchetypeMigration) {
+    EntityManager em;
+    auto a = em.CreateEntity("A");
+    auto b = em.CreateEntity("B");
+    em.AddComponent<Transform>(a, glm::vec3(1.0f, 0.0f, 0.0f));
+    em.AddComponent<Transform>(b, glm::vec3(2.0f, 0.0f, 0.0f));
+    em.AddComponent<RigidBody>(a).mass = 5.0f;
+
+    // Moving 'a' into the Transform+RigidBody archetype must not disturb 'b'
+    ASSERT_FLOAT_EQ(em.GetComponent<Transform>(a)->position.x, 1.0f);
+    ASSERT_FLOAT_EQ(em.GetComponent<Transform>(b)->position.x, 2.0f);
+    ASSERT_FLOAT_EQ(em.GetComponent<RigidBody>(a)->mass, 5.0f);
+    ASSERT_NULL(em.GetComponent<RigidBody>(b));
+
+    em.RemoveComponent<RigidBody>(a);
+    ASSERT(!em.HasComponent<RigidBody>(a));
+    ASSERT_FLOAT_EQ(em.GetComponent<Transform>(a)->position.x, 1.0f);
+}
+
+REGISTER_TEST(EntityManager_EachSweepsChunks) {
+    EntityManager em;
+    const int count = 5000;  // Spans several chunks
+    for (int i = 0; i < count; ++i) {
+        auto id = em.CreateEntity();
+        em.AddComponent<Transform>(id, glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        if (i % 2 == 0) em.AddComponent<RigidBody>(id);
+    }
+
+    // Destroy a few rows to exercise swap-removal across chunks
+    em.DestroyEntity(1);
+    em.DestroyEntity(2);
+
+    int visited = 0;
+    em.Each<Transform, RigidBody>([&visited](EntityID, Transform& t, RigidBody&) {
+        ASSERT(static_cast<int>(t.position.x) % 2 == 0);
+        visited++;
+    });
+    ASSERT_EQ(visited, count / 2 - 1);
+
+    int transforms = 0;
+    em.Each<Transform>([&transforms](EntityID, Transform&) { transforms++; });
+    ASSERT_EQ(transforms, count - 2);
+}
+
+REGISTER_TEST(EntityManager_ChunkPoolReusesBlocks) {
+    EntityManager em;
+    em.ReserveEntities(5000);
+
+    auto spawnWave = [&em]() {
+        std::vector<EntityID> wave;
+        for (int i = 0; i < 5000; ++i) {
+            EntityID id = em.CreateEntity("Projectile");
+            em.AddComponent<Transform>(id);
+            em.AddComponent<RigidBody>(id);
+            wave.push_back(id);
+        }
+        return wave;
+    };
+
+    auto wave = spawnWave();
+    uint64_t allocations = em.GetChunkPool().GetStats().systemAllocations;
+    ASSERT(allocations > 0);
+
+    for (int round = 0; round < 3; ++round) {
+        for (EntityID id : wave) em.DestroyEntity(id);
+        // Emptied chunks go back to the pool, apart from one per archetype
+        ASSERT(em.GetChunkPool().GetStats().blocksInUse <= em.GetArchetypes().size());
+        wave = spawnWave();
+    }
+
+    // Later waves (including their archetype migrations) ran entirely on recycled blocks
+    ASSERT(em.GetChunkPool().GetStats().systemAllocations == allocations);
+    ASSERT(em.GetChunkPool().GetStats().reuses > 0);
+}
+
+REGISTER_TEST(View_RangeForYieldsReferences) {
+    EntityManager em;
+    auto view = em.GetView<Transform, RigidBody>();  // Created before any match exists
+    ASSERT(view.Empty());
+
+    auto a = em.CreateEntity();
+    auto b = em.CreateEntity();
+    auto c = em.CreateEntity();
+    em.AddComponent<Transform>(a);
+    em.AddComponent<RigidBody>(a).velocity = glm::vec3(1.0f, 0.0f, 0.0f);
+    em.AddComponent<Transform>(b);
+    em.AddComponent<RigidBody>(c);
+
+    for (auto [transform, body] : view) {
+        transform.position += body.velocity;
+    }
+    ASSERT_FLOAT_EQ(em.GetComponent<Transform>(a)->position.x, 1.0f);
+    ASSERT_EQ(static_cast<int>(view.Size()), 1);
+
+    // Entities joining or leaving the query are picked up without rebuilding the view
+    em.AddComponent<RigidBody>(b);
+    em.AddComponent<Renderable>(a);
+    int count = 0;
+    view.Each([&count](EntityID, Transform&, RigidBody&) { count++; });
+    ASSERT_EQ(count, 2);
+
+    em.RemoveComponent<RigidBody>(a);
+    count = 0;
+    for (auto it = view.begin(); it != view.end(); ++it) {
+        ASSERT(it.GetEntity() == b);
+        count++;
+    }
+    ASSERT_EQ(count, 1);
+}
+
+REGISTER_TEST(View_ChangedFilterSkipsUntouchedChunks) {
+    EntityManager em;
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 2000; ++i) {
+        ids.push_back(em.CreateEntity());
+        em.AddComponent<Transform>(ids.back());
+    }
+    auto view = em.GetView<const Transform>();
+    ASSERT(view.GetChunkCount() > 2);
+
+    ChangeCursor cursor;
+    ASSERT_EQ(static_cast<int>(view.Changed<Transform>(cursor.Begin(em)).Size()), 2000);
+    ASSERT(view.Changed<Transform>(cursor.Begin(em)).Empty());  // const views do not stamp
+
+    // A single write flags only that entity's chunk
+    em.GetComponent<Transform>(ids[1500])->position.x = 5.0f;
+    auto changed = view.Changed<Transform>(cursor.Begin(em));
+    ASSERT_EQ(static_cast<int>(changed.GetChunkCount()), 1);
+    bool found = false;
+    for (auto it = changed.begin(); it != changed.end(); ++it) {
+        found = found || it.GetEntity() == ids[1500];
+    }
+    ASSERT(found);
+    ASSERT(changed.Size() < 2000);
+
+    // Mutable views stamp every chunk they visit
+    em.GetView<Transform>().Each([](EntityID, Transform&) {});
+    ASSERT_EQ(static_cast<int>(view.Changed<Transform>(cursor.Begin(em)).Size()), 2000);
+    ASSERT(view.Changed<Transform>(cursor.Begin(em)).Empty());
+}
+
+REGISTER_TEST(View_AddedFilterSeesNewComponents) {
+    EntityManager em;
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 10; ++i) {
+        ids.push_back(em.CreateEntity());
+        em.AddComponent<Transform>(ids.back());
+    }
+
+    ChangeCursor cursor;
+    cursor.Begin(em);
+    em.AddComponent<Renderable>(ids[3]);
+
+    uint32_t since = cursor.Begin(em);
+    auto added = em.GetView<const Transform, const Renderable>().Added<Renderable>(since);
+    ASSERT_EQ(static_cast<int>(added.Size()), 1);
+    ASSERT(added.begin().GetEntity() == ids[3]);
+
+    // Moving archetypes keeps the Transform history, so it is not reported as changed
+    ASSERT(em.GetView<const Transform>().Changed<Transform>(since).Empty());
+    ASSERT(em.GetView<const Renderable>().Added<Renderable>(cursor.Begin(em)).Empty());
+}
+
+REGISTER_TEST(TransformHierarchy_PropagatesOnlyWhenMoved) {
+    EntityManager em;
+    EntityID player = em.CreateEntity("Player");
+    EntityID weapon = em.CreateEntity("Weapon");
+    EntityID scope = em.CreateEntity("Scope");
+    em.AddComponent<Transform>(player, glm::vec3(10.0f, 0.0f, 0.0f));
+    em.AddComponent<Transform>(weapon, glm::vec3(1.0f, 0.0f, 0.0f));
+    em.AddComponent<Transform>(scope, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    TransformHierarchy hierarchy;
+    hierarchy.SetParent(scope, weapon);
+    hierarchy.SetParent(weapon, player);
+    hierarchy.Update(em);
+    ASSERT_EQ(static_cast<int>(hierarchy.GetNodeCount()), 3);
+    glm::mat4 scopeWorld = hierarchy.GetWorldMatrix(em, scope);
+    ASSERT_FLOAT_EQ(scopeWorld[3].x, 11.0f);
+    ASSERT_FLOAT_EQ(scopeWorld[3].y, 1.0f);
+
+    // Nothing moved: no recomputation
+    hierarchy.Update(em);
+    ASSERT_EQ(static_cast<int>(hierarchy.GetLastUpdateCount()), 0);
+
+    // Moving the root drags the whole subtree along
+    em.GetComponent<Transform>(player)->position.x = 20.0f;
+    hierarchy.Update(em);
+    ASSERT(hierarchy.GetLastUpdateCount() >= 3);
+    ASSERT_FLOAT_EQ(hierarchy.GetWorldMatrix(em, scope)[3].x, 21.0f);
+
+    bool threw = false;
+    try { hierarchy.SetParent(player, scope); } catch (const std::runtime_error&) { threw = true; }
+    ASSERT(threw);
+
+    // Destroying a parent detaches its children
+    em.DestroyEntity(weapon);
+    hierarchy.Update(em);
+    ASSERT(hierarchy.GetParent(scope) == invalid_entity::value);
+    ASSERT_EQ(static_cast<int>(hierarchy.GetNodeCount()), 0);
+    ASSERT_FLOAT_EQ(hierarchy.GetWorldMatrix(em, scope)[3].y, 1.0f);
+}
+
+REGISTER_TEST(TransformBatch_MatchesScalarAndModelMatrix) {
+    // Odd count so every level also runs its scalar tail
+    std::vector<Transform> transforms(203);
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        float f = static_cast<float>(i);
+        transforms[i].position = glm::vec3(f, -2.0f * f, 0.5f);
+        transforms[i].rotation = glm::vec3(f * 0.37f - 30.0f, f * -0.11f, f * 0.05f + 1.0f);
+        transforms[i].scale = glm::vec3(1.0f + f * 0.01f, 2.0f, 0.5f);
+    }
+
+    std::vector<float> lanes(transforms.size() * 9);
+    TransformArrays arrays;
+    arrays.count = transforms.size();
+    for (int k = 0; k < 3; ++k) {
+        float* lane[3] = { &lanes[transforms.size() * k], &lanes[transforms.size() * (3 + k)],
+                           &lanes[transforms.size() * (6 + k)] };
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            lane[0][i] = transforms[i].position[k];
+            lane[1][i] = transforms[i].rotation[k];
+            lane[2][i] = transforms[i].scale[k];
+        }
+        arrays.position[k] = lane[0];
+        arrays.rotation[k] = lane[1];
+        arrays.scale[k] = lane[2];
+    }
+
+    std::vector<glm::mat4> scalar(transforms.size());
+    std::vector<glm::mat4> simd(transforms.size());
+    ComputeModelMatrices(arrays, scalar.data(), SimdLevel::Scalar);
+    for (SimdLevel level : { SimdLevel::SSE2, SimdLevel::AVX2 }) {
+        ComputeModelMatrices(arrays, simd.data(), level);
+        ASSERT(std::memcmp(scalar.data(), simd.data(), sizeof(glm::mat4) * simd.size()) == 0);
+    }
+
+    ComputeModelMatrices(transforms.data(), transforms.size(), simd.data());
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        glm::mat4 expected = transforms[i].GetModelMatrix();
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                ASSERT(std::fabs(simd[i][c][r] - expected[c][r]) <= 1e-5f * std::max(1.0f, std::fabs(expected[c][r])));
+            }
+        }
+    }
+}
+
+REGISTER_TEST(FixedTimestep_AccumulatesAndGuardsSpiral) {
+    FixedTimestep timestep(50, 4);  // 20 ms ticks
+    ASSERT_EQ(static_cast<int>(timestep.Advance(0.015)), 0);
+    ASSERT_FLOAT_EQ(timestep.GetAlpha(), 0.75f);
+    ASSERT_EQ(static_cast<int>(timestep.Advance(0.015)), 1);
+    ASSERT(std::fabs(timestep.GetAlpha() - 0.5f) < 1e-4f);
+
+    // A 1 s hitch runs at most 4 ticks and drops the rest, keeping the fraction
+    ASSERT_EQ(static_cast<int>(timestep.Advance(1.0)), 4);
+    ASSERT_EQ(static_cast<int>(timestep.GetDroppedTicks()), 46);
+    ASSERT(std::fabs(timestep.GetAlpha() - 0.5f) < 1e-4f);
+    ASSERT_EQ(static_cast<int>(timestep.GetTickCount()), 5);
+
+    Transform previous(glm::vec3(0.0f));
+    Transform current(glm::vec3(10.0f, 0.0f, 0.0f));
+    previous.rotation.y = 3.0f;
+    current.rotation.y = -3.0f;  // Shortest way is through pi, not through zero
+    Transform blended = Transform::Interpolate(previous, current, 0.5f);
+    ASSERT_FLOAT_EQ(blended.position.x, 5.0f);
+    ASSERT(std::fabs(blended.rotation.y - 3.1415927f) < 1e-4f);
+}
+
+REGISTER_TEST(TransformInterpolator_BlendsLastTwoTicks) {
+    EntityManager em;
+    EntityID mover = em.CreateEntity();
+    EntityID still = em.CreateEntity();
+    em.AddComponent<Transform>(mover);
+    em.AddComponent<Transform>(still, glm::vec3(0.0f, 5.0f, 0.0f));
+    TransformInterpolator interpolator;
+
+    // Tick 1 moves the mover; rendering a quarter of the way into tick 2
+    interpolator.BeginTick(em);
+    em.GetComponent<Transform>(mover)->position.x = 10.0f;
+    const Transform& mover1 = *em.ReadComponent<Transform>(mover);
+    ASSERT_FLOAT_EQ(interpolator.Blend(mover, mover1, 0.25f).position.x, 2.5f);
+    ASSERT_FLOAT_EQ(interpolator.Blend(still, *em.ReadComponent<Transform>(still), 0.25f).position.y, 5.0f);
+    ASSERT_FLOAT_EQ(interpolator.Blend(mover, mover1, 1.0f).position.x, 10.0f);
+
+    // Ticks that do not move it leave it at rest, not replaying the last step
+    interpolator.BeginTick(em);
+    interpolator.BeginTick(em);
+    ASSERT_FLOAT_EQ(interpolator.Blend(mover, *em.ReadComponent<Transform>(mover), 0.5f).position.x, 10.0f);
+
+    // Not captured by a tick yet: drawn where it is
+    EntityID spawned = em.CreateEntity();
+    em.AddComponent<Transform>(spawned, glm::vec3(3.0f));
+    ASSERT_FLOAT_EQ(interpolator.Blend(spawned, *em.ReadComponent<Transform>(spawned), 0.5f).position.x, 3.0f);
+    ASSERT_EQ(static_cast<int>(interpolator.GetTrackedCount()), 2);
+}
+
+REGISTER_TEST(FramePacer_HoldsAbsoluteSchedule) {
+    using namespace std::chrono;
+    FramePacer pacer(200);  // 5 ms frames
+    auto start = steady_clock::now();
+    pacer.Start();
+    for (int frame = 0; frame < 20; ++frame) {
+        pacer.WaitForNextFrame();
+    }
+    double elapsedMs = duration<double, std::milli>(steady_clock::now() - start).count();
+    ASSERT(elapsedMs >= 99.0);
+    ASSERT(elapsedMs < 150.0);  // Loose: sanitizer builds on busy machines
+
+    FramePacer::Stats stats = pacer.GetStats();
+    ASSERT_EQ(static_cast<int>(stats.frames), 20);
+    ASSERT(stats.meanErrorUs >= 0.0);
+
+    // An overrun frame returns at once and does not trigger catch-up frames
+    std::this_thread::sleep_for(milliseconds(20));
+    pacer.WaitForNextFrame();
+    ASSERT_EQ(static_cast<int>(pacer.GetStats().missedFrames), 1);
+    auto before = steady_clock::now();
+    pacer.WaitForNextFrame();
+    double waitedMs = duration<double, std::milli>(steady_clock::now() - before).count();
+    ASSERT(waitedMs > 2.0);
+}
+
+// Component with a heap-owning member, to check payload lifetimes
+class TagComponent : public Component {
+public:
+    std::string tag;
+    TagComponent() = default;
+    explicit TagComponent(std::string value) : tag(std::move(value)) {}
+
+    static constexpr ComponentID StaticID() { return 900; }
+    ComponentID GetComponentID() const override { return StaticID(); }
+};
+
+REGISTER_TEST(ComponentRegistry_SignaturesUseDenseBits) {
+    uint32_t transform = ComponentIndex<Transform>();
+    uint32_t body = ComponentIndex<RigidBody>();
+    ASSERT(transform != body);
+    ASSERT(transform < MAX_COMPONENT_TYPES && body < MAX_COMPONENT_TYPES);
+    ASSERT(ComponentIndex<const Transform>() == transform);
+    ASSERT(ComponentRegistry::GetIndex(Transform::StaticID()) == transform);
+
+    EntityManager em;
+    EntityID e = em.CreateEntity();
+    ASSERT(em.GetSignature(e).none());
+    em.AddComponent<Transform>(e);
+    em.AddComponent<TagComponent>(e, "tagged");
+    ASSERT(em.GetSignature(e) == (MakeComponentMask<Transform, TagComponent>()));
+    ASSERT(em.HasComponents(e, MakeComponentMask<Transform, TagComponent>()));
+    ASSERT(!em.HasComponents(e, MakeComponentMask<Transform, RigidBody>()));
+
+    // Same component set reached in a different order lands in the same archetype
+    EntityID f = em.CreateEntity();
+    em.AddComponent<TagComponent>(f, "other");
+    em.AddComponent<Transform>(f);
+    size_t archetypes = em.GetArchetypes().size();
+    em.RemoveComponent<TagComponent>(e);
+    em.AddComponent<TagComponent>(e, "again");
+    ASSERT(em.GetArchetypes().size() == archetypes);
+    ASSERT(em.GetSignature(e) == em.GetSignature(f));
+    ASSERT(em.GetSignature(em.CreateEntity()).none());
+}
+
+REGISTER_TEST(WorldSnapshot_RestoresAndTakesDeltas) {
+    EntityManager em;
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 3000; ++i) {
+        ids.push_back(em.CreateEntity("Unit" + std::to_string(i)));
+        em.AddComponent<Transform>(ids.back(), glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+        em.AddComponent<RigidBody>(ids.back());
+        if (i % 3 == 0) em.AddComponent<TagComponent>(ids.back(), "tag" + std::to_string(i));
+    }
+
+    WorldSnapshot snapshot;
+    snapshot.Capture(em);
+    ASSERT(!snapshot.GetStats().delta);
+    size_t fullBytes = snapshot.GetStats().copiedBytes;
+
+    // Nothing changed: a repeated capture copies nothing
+    snapshot.Capture(em);
+    ASSERT(snapshot.GetStats().delta);
+    ASSERT_EQ(static_cast<int>(snapshot.GetStats().copiedBytes), 0);
+
+    // Component writes only: restore copies back just the touched chunk column
+    em.GetComponent<Transform>(ids[10])->position.y = 99.0f;
+    snapshot.Restore(em);
+    ASSERT(snapshot.GetStats().delta);
+    ASSERT(snapshot.GetStats().copiedBytes > 0 && snapshot.GetStats().copiedBytes < fullBytes / 10);
+    ASSERT_FLOAT_EQ(em.ReadComponent<Transform>(ids[10])->position.y, 0.0f);
+
+    // Structural changes: spawn, destroy, migrate, rename
+    EntityID spawned = em.CreateEntity("Projectile");
+    em.AddComponent<Transform>(spawned);
+    em.DestroyEntity(ids[0]);
+    em.DestroyEntity(ids[1500]);
+    em.RemoveComponent<RigidBody>(ids[7]);
+    em.GetComponent<TagComponent>(ids[3])->tag = "changed";
+    em.SetName(ids[4], "Renamed");
+
+    snapshot.Restore(em);
+    ASSERT(!snapshot.GetStats().delta);
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 3000);
+    ASSERT(!em.IsAlive(spawned));
+    ASSERT(em.IsAlive(ids[0]) && em.IsAlive(ids[1500]));
+    ASSERT(em.HasComponent<RigidBody>(ids[7]));
+    ASSERT_FLOAT_EQ(em.ReadComponent<Transform>(ids[1500])->position.x, 1500.0f);
+    ASSERT_STR_EQ(em.ReadComponent<TagComponent>(ids[3])->tag, "tag3");
+    ASSERT_STR_EQ(em.GetName(ids[4]), "Unit4");
+    ASSERT_EQ(static_cast<int>(em.GetView<const Transform, const RigidBody>().Size()), 3000);
+    ASSERT_EQ(static_cast<int>(em.GetView<const TagComponent>().Size()), 1000);
+
+    // Creating an entity after the rollback hands out the same ID again
+    ASSERT(em.CreateEntity("Projectile") == spawned);
+
+    // Forking into another manager, plus gamemode state through the engine's blob
+    EntityManager fork;
+    snapshot.Restore(fork);
+    ASSERT_EQ(static_cast<int>(fork.GetEntityCount()), 3000);
+    ASSERT_FLOAT_EQ(fork.ReadComponent<Transform>(ids[2999])->position.x, 2999.0f);
+    ASSERT_STR_EQ(fork.ReadComponent<TagComponent>(ids[2997])->tag, "tag2997");
+
+    BombDefusalGamemode gamemode;
+    gamemode.SetWorld(&em);
+    gamemode.SaveRoundStart();
+    gamemode.StartRound();
+    gamemode.PlantBomb(1);
+    gamemode.SaveState(snapshot.GetGameState());
+    em.GetComponent<Transform>(ids[5])->position.x = -1.0f;
+    gamemode.DefuseBomb(2);
+    ASSERT(!gamemode.IsBombPlanted());
+
+    gamemode.LoadState(snapshot.GetGameState());
+    ASSERT(gamemode.IsBombPlanted());
+    gamemode.StartRound();  // Resets the world to the saved round start
+    ASSERT_FLOAT_EQ(em.ReadComponent<Transform>(ids[5])->position.x, 5.0f);
+}
+
+REGISTER_TEST(CommandBuffer_DeferredDuringIteration) {
+    EntityManager em;
+    std::vector<EntityID> ids;
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(em.CreateEntity());
+        em.AddComponent<Transform>(ids.back()).position.x = static_cast<float>(i);
+    }
+
+    // Structural changes while iterating are recorded, not applied
+    EntityCommandBuffer commands;
+    em.GetView<Transform>().Each([&commands](EntityID id, Transform& transform) {
+        if (static_cast<int>(transform.position.x) % 2 == 0) {
+            commands.DestroyEntity(id);
+        } else {
+            commands.AddComponent<TagComponent>(id, std::string(32, 'x'));
+        }
+    });
+    EntityID spawned = commands.CreateEntity("Spawned");
+    ASSERT(IsPendingEntity(spawned));
+    commands.AddComponent<Transform>(spawned);
+    commands.AddComponent<TagComponent>(spawned, "first");
+    commands.AddComponent<TagComponent>(spawned, "second");  // replaces
+    commands.AddComponent<TagComponent>(ids[0], "late");     // target destroyed earlier: skipped
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 100);
+
+    commands.Apply(em);
+    ASSERT(commands.IsEmpty());
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 51);
+    ASSERT(!em.IsAlive(ids[0]));
+    ASSERT_EQ(static_cast<int>(em.GetView<Transform, TagComponent>().Size()), 51);
+
+    int found = 0;
+    em.GetView<TagComponent>().Each([&](EntityID id, TagComponent& tag) {
+        if (em.GetName(id) == "Spawned") {
+            ASSERT(tag.tag == "second");
+            found++;
+        }
+    });
+    ASSERT_EQ(found, 1);
+
+    // Unapplied values are destroyed with the buffer
+    commands.AddComponent<TagComponent>(ids[1], std::string(64, 'y'));
+}
+
+REGISTER_TEST(EntityManager_ClearLeavesOldHandlesStale) {
+    EntityManager em;
+    std::vector<EntityID> before;
+    for (int i = 0; i < 4; ++i) {
+        before.push_back(em.CreateEntity());
+        em.AddComponent<Transform>(before.back());
+    }
+    em.DestroyEntity(before[1]);
+
+    em.Clear();
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 0);
+
+    // New entities reuse the slots under new generations
+    std::vector<EntityID> after;
+    for (int i = 0; i < 4; ++i) after.push_back(em.CreateEntity());
+    for (EntityID old : before) {
+        ASSERT(!em.IsAlive(old));
+        ASSERT(!em.GetEntity(old).IsValid());
+        ASSERT(std::find(after.begin(), after.end(), old) == after.end());
+    }
+    for (EntityID id : after) {
+        ASSERT(em.IsAlive(id));
+        ASSERT(GetEntityIndex(id) <= 4);
+    }
+}
+
+REGISTER_TEST(CommandBuffer_RemovesTheNamedComponent) {
+    EntityManager em;
+    EntityID id = em.CreateEntity();
+    em.AddComponent<Transform>(id);
+    em.AddComponent<RigidBody>(id);
+    em.AddComponent<TagComponent>(id, "kept");
+
+    // Whatever their dense indices, only the named types go
+    EntityCommandBuffer commands;
+    commands.RemoveComponent<RigidBody>(id);
+    commands.Apply(em);
+    ASSERT(em.HasComponent<Transform>(id));
+    ASSERT(!em.HasComponent<RigidBody>(id));
+    ASSERT(em.HasComponent<TagComponent>(id));
+
+    commands.RemoveComponent<Transform>(id);
+    commands.Apply(em);
+    ASSERT(!em.HasComponent<Transform>(id));
+    ASSERT(em.ReadComponent<TagComponent>(id)->tag == "kept");
+}
+
+REGISTER_TEST(CommandBuffer_PerThreadFlush) {
+    EntityManager em;
+    JobSystem jobs(3);
+
+    jobs.ParallelFor(1000, [&em](size_t begin, size_t end) {
+        EntityCommandBuffer& commands = em.GetCommandBuffer();
+        for (size_t i = begin; i < end; ++i) {
+            EntityID id = commands.CreateEntity();
+            commands.AddComponent<Transform>(id);
+        }
+    }, 50);
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 0);
+
+    em.FlushCommands();
+    ASSERT_EQ(static_cast<int>(em.GetEntityCount()), 1000);
+    ASSERT_EQ(static_cast<int>(em.GetView<Transform>().Size()), 1000);
+    ASSERT(em.GetCommandBuffer().IsEmpty());
+}
+
 REGISTER_TEST(EventBus_Subscribe) {
     EventBus bus;
     int callCount = 0;
@@ -62,6 +656,137 @@ REGISTER_TEST(EventBus_Subscribe) {
     ASSERT_EQ(callCount, 1);
 }
 
+REGISTER_TEST(EventBus_TypedChannelQueuesUntilDispatch) {
+    EventBus bus;
+    SimpleInputSystem input;
+    input.SetEventBus(&bus);
+
+    std::vector<KeyCode> keys;
+    int repeats = 0;
+    auto& channel = bus.Channel<KeyPressedEvent>();
+    ASSERT(&channel == &bus.Channel<KeyPressedEvent>());
+    channel.Subscribe([&](const KeyPressedEvent& event) {
+        keys.push_back(event.key);
+        if (event.repeated) repeats++;
+    });
+
+    input.OnKeyPressed(KeyCode::W);
+    input.OnKeyPressed(KeyCode::W);
+    input.OnKeyPressed(KeyCode::Space);
+    ASSERT(keys.empty());
+    ASSERT_EQ(static_cast<int>(channel.GetPendingCount()), 3);
+
+    bus.Dispatch();
+    ASSERT_EQ(static_cast<int>(keys.size()), 3);
+    ASSERT(keys[2] == KeyCode::Space);
+    ASSERT_EQ(repeats, 1);
+
+    // Events published while dispatching wait for the next batch
+    int rounds = 0;
+    BombDefusalGamemode gamemode;
+    gamemode.SetEventBus(&bus);
+    bus.Channel<RoundEndedEvent>().Subscribe([&](const RoundEndedEvent& event) {
+        rounds++;
+        ASSERT(event.gamemode == GamemodeType::BombDefusal);
+        bus.Channel<KeyPressedEvent>().Publish(KeyPressedEvent(KeyCode::Escape));
+    });
+    gamemode.StartRound();
+    gamemode.EndRound();
+    bus.Dispatch();
+    ASSERT_EQ(rounds, 1);
+    ASSERT_EQ(static_cast<int>(keys.size()), 3);
+    bus.Dispatch();
+    ASSERT_EQ(static_cast<int>(keys.size()), 4);
+}
+
+REGISTER_TEST(EventBus_PublishAsyncFromWorkers) {
+    EventChannel<PlayerDeathEvent> channel(4096);
+    std::vector<int> seen(4000, 0);
+    channel.Subscribe([&seen](const PlayerDeathEvent& event) { seen[event.playerID]++; });
+
+    JobSystem jobs(3);
+    jobs.ParallelFor(seen.size(), [&channel](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            channel.PublishAsync(PlayerDeathEvent(static_cast<uint32_t>(i), 0));
+        }
+    }, 100);
+    channel.Dispatch();
+    ASSERT(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+    ASSERT(channel.GetDroppedCount() == 0);
+
+    // A full ring rejects instead of blocking or allocating
+    EventChannel<PlayerDeathEvent> small(4);
+    int accepted = 0;
+    for (uint32_t i = 0; i < 6; ++i) {
+        if (small.PublishAsync(PlayerDeathEvent(i, 0))) accepted++;
+    }
+    ASSERT_EQ(accepted, 4);
+    ASSERT(small.GetDroppedCount() == 2);
+}
+
+REGISTER_TEST(LinearArena_ResetReusesBlocks) {
+    LinearArena arena(1024);
+    auto first = arena.AllocateArray<uint32_t>(100);
+    ASSERT_EQ(static_cast<int>(first.Size()), 100);
+    ASSERT(reinterpret_cast<uintptr_t>(arena.Allocate(24, 64)) % 64 == 0);
+
+    // Overflow adds a block; reset keeps it for the next frame
+    arena.AllocateArray<uint8_t>(4000);
+    size_t capacity = arena.GetCapacity();
+    size_t peak = arena.GetPeakBytes();
+    ASSERT(peak >= 4400);
+    arena.Reset();
+    ASSERT_EQ(static_cast<int>(arena.GetUsedBytes()), 0);
+    ASSERT(arena.AllocateArray<uint32_t>(100).data == first.data);
+    arena.AllocateArray<uint8_t>(4000);
+    ASSERT(arena.GetCapacity() == capacity);
+    ASSERT(arena.GetPeakBytes() == peak);
+
+    // Scopes rewind nested allocations
+    size_t before = arena.GetUsedBytes();
+    {
+        ArenaScope scope(arena);
+        arena.AllocateArray<float>(64);
+        ASSERT(arena.GetUsedBytes() > before);
+    }
+    ASSERT(arena.GetUsedBytes() == before);
+}
+
+REGISTER_TEST(SpatialHash_QueryOverloadsAgree) {
+    SpatialHash hash(10.0f);
+    for (int i = 0; i < 50; ++i) {
+        hash.Insert(static_cast<EntityID>(i + 1), glm::vec3(static_cast<float>(i * 3), 0.0f, 0.0f));
+    }
+
+    auto expected = hash.QuerySphere(glm::vec3(40.0f, 0.0f, 0.0f), 15.0f);
+    ASSERT(!expected.empty());
+
+    std::vector<EntityID> reused;
+    hash.QuerySphere(glm::vec3(40.0f, 0.0f, 0.0f), 15.0f, reused);
+    ASSERT(reused == expected);
+
+    LinearArena arena;
+    Span<EntityID> span = hash.QuerySphere(glm::vec3(40.0f, 0.0f, 0.0f), 15.0f, arena);
+    ASSERT(std::vector<EntityID>(span.begin(), span.end()) == expected);
+
+    AABB box(glm::vec3(0.0f, -1.0f, -1.0f), glm::vec3(25.0f, 1.0f, 1.0f));
+    Span<EntityID> boxSpan = hash.QueryAABB(box, arena);
+    ASSERT(std::vector<EntityID>(boxSpan.begin(), boxSpan.end()) == hash.QueryAABB(box));
+}
+
+REGISTER_TEST(Frustum_FromViewProjection) {
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    Frustum frustum = Frustum::FromViewProjection(projection * view);
+
+    ASSERT(frustum.Contains(glm::vec3(0.0f, 0.0f, -10.0f)));
+    ASSERT(!frustum.Contains(glm::vec3(0.0f, 0.0f, 10.0f)));     // behind
+    ASSERT(!frustum.Contains(glm::vec3(0.0f, 0.0f, -200.0f)));   // past far
+    ASSERT(!frustum.Contains(glm::vec3(20.0f, 0.0f, -10.0f)));   // outside the 90 degree cone
+    ASSERT(frustum.Contains(Sphere{ glm::vec3(11.0f, 0.0f, -10.0f), 2.0f }));
+    ASSERT(frustum.Contains(AABB(glm::vec3(9.0f, -1.0f, -11.0f), glm::vec3(12.0f, 1.0f, -9.0f))));
+}
+
 REGISTER_TEST(Transform_GetModelMatrix) {
     Transform t;
     t.position = glm::vec3(1.0f, 2.0f, 3.0f);
@@ -80,6 +805,782 @@ REGISTER_TEST(Transform_GetForward) {
     ASSERT_FLOAT_EQ(forward.z, 1.0f);
 }
 
+// ============================================================================
+// Job System Tests
+// ============================================================================
+
+REGISTER_TEST(JobSystem_ParallelForCoversRange) {
+    JobSystem jobs(3);
+    std::vector<int> hits(10000, 0);
+    jobs.ParallelFor(hits.size(), [&hits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) hits[i]++;
+    });
+    ASSERT(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+
+    // Nested ParallelFor from inside a job must not deadlock
+    std::atomic<int> total{0};
+    jobs.ParallelFor(8, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            jobs.ParallelFor(100, [&total](size_t b, size_t e) { total += static_cast<int>(e - b); });
+        }
+    });
+    ASSERT_EQ(total.load(), 800);
+}
+
+REGISTER_TEST(JobSystem_CountersAndDependencies) {
+    JobSystem jobs(2);
+    std::atomic<int> stage{0};
+    std::atomic<bool> orderOk{true};
+
+    JobCounter first, second;
+    for (int i = 0; i < 16; ++i) {
+        jobs.Run([&stage]() { stage++; }, &first);
+    }
+    jobs.RunAfter(first, [&]() {
+        if (stage.load() != 16) orderOk = false;
+    }, &second);
+    jobs.Wait(second);
+    ASSERT(first.IsDone());
+    ASSERT(orderOk.load());
+
+    // Exceptions surface from Wait on the job's counter
+    JobCounter failing;
+    jobs.Run([]() { throw std::runtime_error("job failed"); }, &failing);
+    bool caught = false;
+    try { jobs.Wait(failing); } catch (const std::runtime_error&) { caught = true; }
+    ASSERT(caught);
+
+    // Without workers everything runs on the waiting thread
+    JobSystem inline0(0);
+    JobCounter counter;
+    int ran = 0;
+    inline0.Run([&ran]() { ran++; }, &counter);
+    inline0.Wait(counter);
+    ASSERT_EQ(ran, 1);
+}
+
+// ============================================================================
+// Scheduler Tests
+// ============================================================================
+
+class TestSystem : public ISystem {
+public:
+    const char* name{"System"};
+    std::function<void(SystemAccess&)> declare;
+    std::function<void(float)> update;
+
+    const char* GetName() const override { return name; }
+    void Update(float deltaTime) override { update(deltaTime); }
+    void DeclareAccess(SystemAccess& access) const override {
+        if (declare) declare(access);
+        else ISystem::DeclareAccess(access);
+    }
+};
+
+REGISTER_TEST(Scheduler_ConflictsKeepRegistrationOrder) {
+    std::mutex orderMutex;
+    std::vector<int> order;
+    std::thread::id mainThread = std::this_thread::get_id();
+    bool mainOnMainThread = false;
+
+    TestSystem writer, reader, other, exclusive;
+    writer.declare = [](SystemAccess& a) { a.Write<Transform>(); };
+    reader.declare = [](SystemAccess& a) { a.Read<Transform>().MainThreadOnly(); };
+    other.declare = [](SystemAccess& a) { a.Write<RigidBody>(); };
+    auto record = [&](int id) {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(id);
+    };
+    writer.update = [&](float) { record(0); };
+    reader.update = [&](float) {
+        mainOnMainThread = std::this_thread::get_id() == mainThread;
+        record(1);
+    };
+    other.update = [&](float) { record(2); };
+    exclusive.update = [&](float) { record(3); };
+
+    JobSystem jobs(3);
+    SystemScheduler scheduler(jobs);
+    scheduler.SetSystems({ &writer, &reader, &other, &exclusive });
+
+    ASSERT_EQ(static_cast<int>(scheduler.GetDependencies(1).size()), 1);
+    ASSERT(scheduler.GetDependencies(2).empty());
+    ASSERT_EQ(static_cast<int>(scheduler.GetDependencies(3).size()), 3);
+
+    for (int frame = 0; frame < 50; ++frame) {
+        order.clear();
+        scheduler.Run(0.016f);
+        ASSERT_EQ(static_cast<int>(order.size()), 4);
+        auto writerPos = std::find(order.begin(), order.end(), 0);
+        auto readerPos = std::find(order.begin(), order.end(), 1);
+        ASSERT(writerPos < readerPos);
+        ASSERT_EQ(order.back(), 3);
+        ASSERT(mainOnMainThread);
+    }
+}
+
+REGISTER_TEST(Scheduler_ParallelMatchesSequential) {
+    auto simulate = [](int workers) {
+        EntityManager em;
+        for (int i = 0; i < 500; ++i) {
+            auto id = em.CreateEntity();
+            em.AddComponent<Transform>(id);
+            em.AddComponent<RigidBody>(id).velocity = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        }
+
+        TestSystem accelerate, integrate, scale;
+        accelerate.declare = [](SystemAccess& a) { a.Write<RigidBody>(); };
+        accelerate.update = [&em](float dt) {
+            for (auto [body] : em.GetView<RigidBody>()) body.velocity.y -= 9.81f * dt;
+        };
+        integrate.declare = [](SystemAccess& a) { a.Read<RigidBody>().Write<Transform>(); };
+        integrate.update = [&em](float dt) {
+            for (auto [transform, body] : em.GetView<Transform, RigidBody>()) transform.position += body.velocity * dt;
+        };
+        scale.declare = [](SystemAccess& a) { a.Write<Transform>(); };
+        scale.update = [&em](float) {
+            for (auto [transform] : em.GetView<Transform>()) transform.scale *= 1.01f;
+        };
+
+        JobSystem jobs(workers);
+        SystemScheduler scheduler(jobs);
+        scheduler.SetSystems({ &accelerate, &integrate, &scale });
+        for (int frame = 0; frame < 20; ++frame) scheduler.Run(0.016f);
+
+        std::vector<float> result;
+        for (auto [transform] : em.GetView<Transform>()) {
+            result.push_back(transform.position.x);
+            result.push_back(transform.position.y);
+            result.push_back(transform.scale.x);
+        }
+        return result;
+    };
+
+    ASSERT(simulate(0) == simulate(4));
+}
+
+// ============================================================================
+// Physics Tests
+// ============================================================================
+
+REGISTER_TEST(Physics_IndependentWorldsOnSeparateThreads) {
+    auto simulate = [](float gravityY, JobSystem* jobs) {
+        EntityManager em;
+        for (int i = 0; i < 300; ++i) {
+            auto id = em.CreateEntity();
+            em.AddComponent<Transform>(id);
+            em.AddComponent<RigidBody>(id).velocity = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        }
+
+        SimplePhysicsSystem physics;
+        physics.SetWorld(&em, jobs);
+        physics.SetGravity(glm::vec3(0.0f, gravityY, 0.0f));
+        for (int tick = 0; tick < 30; ++tick) physics.Update(1.0f / 60.0f);
+
+        std::vector<float> result;
+        for (auto [transform] : em.GetView<const Transform>()) {
+            result.push_back(transform.position.x);
+            result.push_back(transform.position.y);
+        }
+        return result;
+    };
+
+    std::vector<float> moonAlone = simulate(-1.62f, nullptr);
+    std::vector<float> earthAlone = simulate(-9.81f, nullptr);
+    ASSERT(moonAlone != earthAlone);
+
+    // Same worlds again, concurrently, one of them on its own job system
+    std::vector<float> moon, earth;
+    std::thread moonThread([&]() { moon = simulate(-1.62f, nullptr); });
+    std::thread earthThread([&]() {
+        JobSystem jobs(2);
+        earth = simulate(-9.81f, &jobs);
+    });
+    moonThread.join();
+    earthThread.join();
+
+    ASSERT(moon == moonAlone);
+    ASSERT(earth == earthAlone);
+}
+
+// ============================================================================
+// Profiler Tests
+// ============================================================================
+
+REGISTER_TEST(Profiler_RecordsNestedZonesPerThread) {
+    Profiler::Clear();
+    {
+        TITAN_PROFILE_SCOPE("Disabled");
+    }
+    ASSERT(Profiler::Collect().empty());
+
+    Profiler::SetThreadName("Test Runner");
+    Profiler::SetEnabled(true);
+    {
+        TITAN_PROFILE_SCOPE("Outer");
+        TITAN_PROFILE_SCOPE("Inner");
+    }
+
+    TestSystem system;
+    system.declare = [](SystemAccess& a) { a.Write<Transform>(); };
+    system.update = [](float) {};
+    TestSystem other = system;
+    other.declare = [](SystemAccess& a) { a.Write<RigidBody>(); };
+    {
+        JobSystem jobs(2);
+        SystemScheduler scheduler(jobs);
+        scheduler.SetSystems({ &system, &other });
+        scheduler.Run(0.016f);
+    }
+
+    // A small ring keeps only the newest events
+    Profiler::SetBufferCapacity(8);
+    std::thread flood([]() {
+        for (int i = 0; i < 20; ++i) {
+            TITAN_PROFILE_SCOPE("Flood");
+        }
+    });
+    flood.join();
+    Profiler::SetBufferCapacity(1 << 16);
+    Profiler::SetEnabled(false);
+
+    int systemZones = 0;
+    bool nested = false, wrapped = false;
+    for (const auto& thread : Profiler::Collect()) {
+        for (const auto& event : thread.events) {
+            if (std::strcmp(event.name, "System") == 0) systemZones++;
+        }
+        if (thread.events.size() >= 2 && std::strcmp(thread.events[0].name, "Inner") == 0) {
+            const auto& inner = thread.events[0];
+            const auto& outer = thread.events[1];
+            nested = inner.depth == 1 && outer.depth == 0 &&
+                     outer.startNs <= inner.startNs && inner.endNs <= outer.endNs;
+        }
+        if (std::strcmp(thread.events[0].name, "Flood") == 0) {
+            wrapped = thread.events.size() == 8 && thread.dropped == 12;
+        }
+    }
+    ASSERT(nested);
+    ASSERT(wrapped);
+    ASSERT_EQ(systemZones, 2);
+
+    std::ostringstream trace;
+    Profiler::WriteChromeTrace(trace);
+    ASSERT(trace.str().find("\"traceEvents\"") != std::string::npos);
+    ASSERT(trace.str().find("{\"name\":\"Outer\",\"ph\":\"X\"") != std::string::npos);
+    ASSERT(trace.str().find("\"args\":{\"name\":\"Test Runner\"}") != std::string::npos);
+
+    Profiler::Clear();
+    ASSERT(Profiler::Collect().empty());
+}
+
+// ============================================================================
+// Performance Monitor Tests
+// ============================================================================
+
+REGISTER_TEST(Histogram_PercentilesWithinBucketError) {
+    Histogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value) histogram.Record(value);
+
+    ASSERT_EQ(static_cast<int>(histogram.GetCount()), 100000);
+    ASSERT_EQ(static_cast<int>(histogram.GetMax()), 100000);
+    for (double percentile : { 50.0, 95.0, 99.0 }) {
+        double exact = percentile * 1000.0;
+        double error = std::abs(static_cast<double>(histogram.Percentile(percentile)) - exact) / exact;
+        ASSERT(error < 1.0 / Histogram::SUB_BUCKETS);
+    }
+    ASSERT(Histogram::BucketIndex(31) == 31 && Histogram::BucketUpperBound(31) == 31);
+    ASSERT(Histogram::BucketIndex(~0ull) == Histogram::BUCKET_COUNT - 1);
+}
+
+REGISTER_TEST(PerformanceMonitor_WindowAndLifetimePercentiles) {
+    PerformanceMonitor monitor(300);
+
+    // 1000 frames at 16 ms; 20 spikes of 100 ms, all in the first 500 frames
+    for (int frame = 0; frame < 1000; ++frame) {
+        monitor.StartFrame();
+        monitor.RecordFrameTime(frame < 500 && frame % 25 == 0 ? 0.1f : 0.016f);
+        monitor.RecordEntityCount(static_cast<uint32_t>(frame));
+        monitor.RecordSystemTime("Physics", 0.002f);
+        monitor.RecordSystemTime("Physics", 0.001f);
+        monitor.EndFrame();
+    }
+    ASSERT_EQ(static_cast<int>(monitor.GetFrameHistory().Size()), 300);
+    ASSERT_EQ(static_cast<int>(monitor.GetFrameHistory()[0].entityCount), 700);
+
+    // The spikes stay out of the average and p95, but not p99 or max
+    auto lifetime = monitor.GetLifetimeStats(PerformanceMonitor::Metric::FrameTime);
+    ASSERT_EQ(static_cast<int>(lifetime.samples), 1000);
+    ASSERT(lifetime.mean < 0.02);
+    ASSERT(std::abs(lifetime.p95 - 0.016) < 0.001);
+    ASSERT(std::abs(lifetime.p99 - 0.1) < 0.004);
+    ASSERT(std::abs(lifetime.max - 0.1) < 1e-6);
+
+    // The spikes have left the 300-frame window
+    auto window = monitor.GetWindowStats(PerformanceMonitor::Metric::FrameTime);
+    ASSERT_EQ(static_cast<int>(window.samples), 300);
+    ASSERT_FLOAT_EQ(static_cast<float>(window.max), 0.016f);
+    ASSERT_FLOAT_EQ(static_cast<float>(monitor.GetWindowStats(PerformanceMonitor::Metric::EntityCount, 10).p50), 994.0f);
+
+    auto physics = monitor.GetSystemWindowStats("Physics");
+    ASSERT_EQ(static_cast<int>(physics.samples), 300);
+    ASSERT_FLOAT_EQ(static_cast<float>(physics.p99), 0.003f);
+    ASSERT_EQ(static_cast<int>(monitor.GetSystemLifetimeStats("Physics").samples), 1000);
+    ASSERT_EQ(static_cast<int>(monitor.GetSystemNames().size()), 1);
+}
+
+REGISTER_TEST(PerformanceMonitor_RanksSchedulerSystems) {
+    TestSystem slow, fast, idle;
+    slow.name = "Slow";
+    slow.declare = [](SystemAccess& a) { a.Write<Transform>(); };
+    slow.update = [](float) {
+        auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+        while (std::chrono::steady_clock::now() < until) {}
+    };
+    fast.name = "Fast";
+    fast.declare = [](SystemAccess& a) { a.Write<RigidBody>(); };
+    fast.update = [](float) {};
+    idle = fast;
+    idle.name = "Idle";
+    idle.declare = [](SystemAccess& a) { a.WriteResource("Idle"); };
+
+    JobSystem jobs(2);
+    SystemScheduler scheduler(jobs);
+    scheduler.SetSystems({ &fast, &slow, &idle });
+
+    // What Engine::UpdateSystems does each tick
+    PerformanceMonitor monitor;
+    for (int frame = 0; frame < 10; ++frame) {
+        monitor.StartFrame();
+        scheduler.Run(0.016f);
+        for (size_t i = 0; i < scheduler.GetSystemCount(); ++i) {
+            monitor.RecordSystemTime(scheduler.GetSystem(i)->GetName(), scheduler.GetLastUpdateTime(i));
+        }
+        monitor.EndFrame();
+    }
+    ASSERT(scheduler.GetLastUpdateTime(1) >= 0.002f);
+
+    auto top = monitor.GetTopSystems(2, 5);
+    ASSERT_EQ(static_cast<int>(top.size()), 2);
+    ASSERT_STR_EQ(std::string(top[0].name), "Slow");
+    ASSERT_EQ(static_cast<int>(top[0].time.samples), 5);
+    ASSERT(top[0].time.p50 >= 0.002);
+
+    std::ostringstream dump;
+    monitor.PrintTopSystems(dump, 2, 5);
+    ASSERT(dump.str().find("Top 2 systems over 5 frames") != std::string::npos);
+    ASSERT(dump.str().find("Slow") < dump.str().find("%"));
+}
+
+REGISTER_TEST(HardwareCounters_FeedZonesAndFrameStats) {
+    CounterSample sample;
+    HardwareCounters::SetEnabled(false);
+    ASSERT(!HardwareCounters::Read(sample));
+
+    // Where perf_event_open is refused every read fails and zones stay plain
+    HardwareCounters::SetEnabled(true);
+    uint32_t available = HardwareCounters::GetAvailableMask();
+    if (available != 0) {
+        CounterSample start, end;
+        ASSERT(HardwareCounters::Read(start));
+        volatile uint64_t sink = 0;
+        for (int i = 0; i < 100000; ++i) sink = sink + static_cast<uint64_t>(i);
+        ASSERT(HardwareCounters::Read(end));
+        CounterSample loop = end.Since(start);
+        ASSERT(loop.validMask == available);
+        if (loop.Has(HardwareCounter::Instructions)) {
+            ASSERT(loop.Get(HardwareCounter::Instructions) >= 100000);
+        }
+
+        Profiler::Clear();
+        Profiler::SetEnabled(true);
+        {
+            TITAN_PROFILE_SCOPE("CountedZone");
+            for (int i = 0; i < 1000; ++i) sink = sink + 1;
+        }
+        Profiler::SetEnabled(false);
+        bool counted = false;
+        for (const auto& thread : Profiler::Collect()) {
+            for (const auto& event : thread.events) {
+                counted = counted || (std::string(event.name) == "CountedZone" && event.counters.validMask == available);
+            }
+        }
+        ASSERT(counted);
+        std::ostringstream trace;
+        Profiler::WriteChromeTrace(trace);
+        Profiler::Clear();
+        ASSERT(trace.str().find("\"args\":{\"") != std::string::npos);
+    }
+    HardwareCounters::SetEnabled(false);
+
+    // Frames without counters are left out of the counter metrics
+    PerformanceMonitor monitor;
+    CounterSample physics;
+    physics.validMask = (1u << static_cast<uint32_t>(HardwareCounter::Cycles)) |
+                        (1u << static_cast<uint32_t>(HardwareCounter::Instructions));
+    physics.values[static_cast<size_t>(HardwareCounter::Cycles)] = 1000;
+    physics.values[static_cast<size_t>(HardwareCounter::Instructions)] = 2500;
+    for (int frame = 0; frame < 3; ++frame) {
+        monitor.StartFrame();
+        monitor.RecordSystemTime("Physics", 0.001f);
+        if (frame > 0) monitor.RecordSystemCounters("Physics", physics);
+        monitor.EndFrame();
+    }
+    auto cycles = monitor.GetWindowStats(PerformanceMonitor::Metric::Cycles);
+    ASSERT_EQ(static_cast<int>(cycles.samples), 2);
+    ASSERT_FLOAT_EQ(static_cast<float>(cycles.mean), 1000.0f);
+    CounterSample total = monitor.GetSystemCounters("Physics");
+    ASSERT_EQ(static_cast<int>(total.Get(HardwareCounter::Instructions)), 5000);
+    ASSERT_FLOAT_EQ(static_cast<float>(total.GetIPC()), 2.5f);
+
+    std::ostringstream csv;
+    monitor.WriteFrameStatsCsv(csv);
+    std::string text = csv.str();
+    ASSERT(text.find(",cycles,instructions,l1d_misses,llc_misses,branch_misses\n") != std::string::npos);
+    ASSERT(text.find(",1000,2500,,,\n") != std::string::npos);
+    ASSERT_EQ(static_cast<int>(std::count(text.begin(), text.end(), '\n')), 4);
+
+    std::ostringstream top;
+    monitor.PrintTopSystems(top, 1);
+    ASSERT(top.str().find("IPC") != std::string::npos);
+}
+
+REGISTER_TEST(HitchRecorder_CapturesFramesAroundSpike) {
+    HitchRecorder::Config config;
+    config.p95Ratio = 4.0f;
+    config.minFrameTime = 0.025f;  // well above scheduler jitter on a steady frame
+    config.framesBefore = 3;
+    config.framesAfter = 2;
+    config.cooldownFrames = 10;
+    config.outputDirectory = (std::filesystem::temp_directory_path() / "titan_hitch_test").string();
+
+    Profiler::Clear();
+    PerformanceMonitor monitor;
+    HitchRecorder recorder(config);
+    recorder.Start();
+    for (int frame = 0; frame < 80; ++frame) {
+        // Real frame durations; frames 61 and 65 fall in the capture and the cooldown
+        bool spike = frame == 60;
+        int sleepMs = (spike || frame == 61 || frame == 65) ? 50 : 1;
+        monitor.StartFrame();
+        {
+            TITAN_PROFILE_SCOPE(spike ? "Spike" : "Steady");
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs));
+        }
+        monitor.EndFrame();
+        recorder.OnFrameEnd(monitor);
+    }
+    recorder.Flush();
+    Profiler::SetEnabled(false);
+    Profiler::Clear();
+
+    ASSERT_EQ(static_cast<int>(recorder.GetCaptures().size()), 1);
+    const HitchRecorder::Capture& capture = recorder.GetCaptures()[0];
+    // The spike's own frame, not the one after it
+    ASSERT_EQ(static_cast<int>(capture.frame), 60);
+    ASSERT(capture.frameTime >= 0.05f);
+    ASSERT(capture.baselineP95 < 0.025f);
+
+    // Three frames before the spike and two after it
+    std::stringstream trace;
+    {
+        std::ifstream file(capture.path);
+        trace << file.rdbuf();
+    }
+    std::string text = trace.str();
+    auto count = [&text](const std::string& needle) {
+        int found = 0;
+        for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) ++found;
+        return found;
+    };
+    ASSERT_EQ(count("\"name\":\"Spike\""), 1);
+    ASSERT_EQ(count("\"name\":\"Steady\""), 5);
+    std::filesystem::remove_all(config.outputDirectory);
+}
+
+// ============================================================================
+// Telemetry Tests
+// ============================================================================
+
+REGISTER_TEST(Telemetry_PublishesThroughSharedMemory) {
+    std::string name = "test-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    TelemetryReader reader;
+    ASSERT(!reader.Open(name));
+
+    TelemetryPublisher publisher;
+    if (!publisher.Open(name, 8)) return;  // no shared memory on this machine
+    ASSERT(reader.Open(name));
+    ASSERT_EQ(static_cast<int>(reader.GetCapacity()), 8);
+
+    PerformanceMonitor monitor;
+    NetworkStats network;
+    for (int frame = 0; frame < 10; ++frame) {
+        monitor.StartFrame();
+        monitor.RecordSystemTime("Physics", 0.002f);
+        monitor.RecordSystemTime("Audio", 0.001f);
+        monitor.RecordEntityCount(static_cast<uint32_t>(frame));
+        monitor.EndFrame();
+        network.messagesSent += 2;
+        publisher.Publish(monitor, &network, 3);
+    }
+    ASSERT_EQ(static_cast<int>(reader.GetPublishedCount()), 10);
+    ASSERT_EQ(static_cast<int>(reader.GetSystemCount()), 2);
+    ASSERT_STR_EQ(std::string(reader.GetSystemName(0)), "Physics");
+    ASSERT_STR_EQ(std::string(reader.GetSystemName(1)), "Audio");
+
+    // The ring holds the last 8 frames; older ones read as overwritten
+    TelemetryFrame frame;
+    ASSERT(!reader.ReadFrame(1, frame));
+    ASSERT(!reader.ReadFrame(10, frame));
+    ASSERT(reader.ReadFrame(2, frame));
+    ASSERT_EQ(static_cast<int>(frame.entityCount), 2);
+    ASSERT(reader.ReadLatest(frame));
+    ASSERT_EQ(static_cast<int>(frame.frameIndex), 9);
+    ASSERT_EQ(static_cast<int>(frame.messagesSent), 20);
+    ASSERT_EQ(static_cast<int>(frame.connectedPlayers), 3);
+    ASSERT_FLOAT_EQ(frame.systemTimes[0], 0.002f);
+    ASSERT_FLOAT_EQ(frame.systemTimes[1], 0.001f);
+
+    // A reader racing the writer only ever sees whole frames
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        TelemetryFrame out;
+        for (uint32_t i = 0; i < 20000; ++i) {
+            out.entityCount = i;
+            out.systemCount = 1;
+            out.systemTimes[0] = static_cast<float>(i);
+            out.bytesSent = i * 3ull;
+            publisher.Publish(out);
+        }
+        done = true;
+    });
+    bool consistent = true;
+    while (!done) {
+        if (reader.ReadLatest(frame) && frame.frameIndex >= 10) {
+            uint64_t i = frame.frameIndex - 10;
+            consistent = consistent && frame.entityCount == i && frame.systemTimes[0] == static_cast<float>(i) &&
+                         frame.bytesSent == i * 3;
+        }
+    }
+    writer.join();
+    ASSERT(consistent);
+    ASSERT_EQ(static_cast<int>(reader.GetPublishedCount()), 20010);
+
+    // Closing the publisher removes the name; the reader keeps its mapping
+    publisher.Close();
+    TelemetryReader late;
+    ASSERT(!late.Open(name));
+    ASSERT(reader.ReadLatest(frame));
+}
+
+// ============================================================================
+// Engine Context Tests
+// ============================================================================
+
+// The engine's C API (Engine.cpp), bound the way a host application does
+extern "C" {
+TITAN_API void* CreateEngine();
+TITAN_API void DestroyEngine(void* engine);
+TITAN_API bool InitializeEngine(void* engine, const char* appName, int width, int height, int targetFPS, bool vsync, bool headless);
+TITAN_API void ShutdownEngine(void* engine);
+TITAN_API void UpdateEngine(void* engine, float deltaTime);
+}
+
+REGISTER_TEST(Engine_TwoHeadlessEnginesKeepSeparateWorlds) {
+    void* engines[2] = { CreateEngine(), CreateEngine() };
+    for (void* engine : engines) {
+        ASSERT(engine != nullptr);
+        ASSERT(InitializeEngine(engine, "Side by side", 0, 0, 0, false, true));
+    }
+
+    // World i holds 100 * (i + 1) bodies moving at i + 1 units per second
+    for (int i = 0; i < 2; ++i) {
+        EntityManager& world = static_cast<Engine*>(engines[i])->GetEntityManager();
+        for (int n = 0; n < 100 * (i + 1); ++n) {
+            EntityID id = world.CreateEntity();
+            world.AddComponent<Transform>(id);
+            RigidBody& body = world.AddComponent<RigidBody>(id);
+            body.velocity = glm::vec3(i + 1.0f, 0.0f, 0.0f);
+            body.useGravity = false;
+        }
+    }
+
+    std::vector<std::thread> hosts;
+    for (void* engine : engines) {
+        hosts.emplace_back([engine]() {
+            for (int tick = 0; tick < 60; ++tick) UpdateEngine(engine, 1.0f / 60.0f);
+        });
+    }
+    for (std::thread& host : hosts) host.join();
+
+    // Same steps on both; twice the velocity gives exactly twice the distance
+    float distance[2] = { 0.0f, 0.0f };
+    for (int i = 0; i < 2; ++i) {
+        EntityManager& world = static_cast<Engine*>(engines[i])->GetEntityManager();
+        ASSERT_EQ(static_cast<int>(world.GetEntityCount()), 100 * (i + 1));
+        bool together = true;
+        distance[i] = -1.0f;
+        world.GetView<const Transform>().Each([&](EntityID, const Transform& transform) {
+            if (distance[i] < 0.0f) distance[i] = transform.position.x;
+            together = together && transform.position.x == distance[i];
+        });
+        ASSERT(together);
+    }
+    ASSERT(distance[0] > 0.5f);
+    ASSERT_FLOAT_EQ(distance[1], 2.0f * distance[0]);
+
+    for (void* engine : engines) {
+        ShutdownEngine(engine);
+        DestroyEngine(engine);
+    }
+}
+
+// ============================================================================
+// Memory Tracking Tests
+// ============================================================================
+
+#ifdef TITAN_ALLOCATION_HOOKS
+
+REGISTER_TEST(MemoryTracker_CountsTaggedAllocations) {
+    MemoryTag tag = RegisterMemoryTag("TestTracking");
+    ASSERT(tag == RegisterMemoryTag("TestTracking"));
+    ASSERT_STR_EQ(std::string(GetMemoryTagName(tag)), "TestTracking");
+
+    // Assertion messages allocate, so check after the measured block
+    AllocationSnapshot before, after;
+    MemoryTag inScope = UNTAGGED_MEMORY;
+    MemoryTracker::TakeSnapshot(before);
+    {
+        MemoryTagScope scope(tag);
+        inScope = MemoryTracker::GetCurrentTag();
+        std::vector<int> values;
+        values.reserve(100);
+        auto boxed = std::make_unique<double>(1.0);
+    }
+    MemoryTracker::TakeSnapshot(after);
+    ASSERT(inScope == tag);
+    ASSERT(MemoryTracker::GetCurrentTag() == UNTAGGED_MEMORY);
+
+    AllocationSnapshot frame = after.Since(before);
+    ASSERT_EQ(static_cast<int>(frame.tags[tag].allocations), 2);
+    ASSERT_EQ(static_cast<int>(frame.tags[tag].frees), 2);
+    ASSERT(frame.tags[tag].allocatedBytes >= 100 * sizeof(int) + sizeof(double));
+    ASSERT_EQ(static_cast<int>(frame.tags[tag].GetLiveBytes()), 0);
+    ASSERT(frame.threads[MemoryTracker::GetThreadSlot()].allocations >= 2);
+
+    // Aligned and allocator-tagged blocks go through the same counters
+    struct alignas(64) Wide { float lanes[16]; };
+    auto wide = std::make_unique<Wide>();
+    ASSERT(reinterpret_cast<uintptr_t>(wide.get()) % 64 == 0);
+
+    MemoryTag poolTag = RegisterMemoryTag("TestPool");
+    MemoryTracker::TakeSnapshot(before);
+    {
+        std::vector<uint64_t, TaggedAllocator<uint64_t>> pool{TaggedAllocator<uint64_t>(poolTag)};
+        pool.resize(32);
+    }
+    MemoryTracker::TakeSnapshot(after);
+    frame = after.Since(before);
+    ASSERT_EQ(static_cast<int>(frame.tags[poolTag].allocations), 1);
+    ASSERT_EQ(static_cast<int>(frame.tags[poolTag].freedBytes), static_cast<int>(32 * sizeof(uint64_t)));
+}
+
+REGISTER_TEST(MemoryTracker_NamesCallSitesAndKeepsExitedThreads) {
+    Profiler::SetEnabled(true);
+    {
+        TITAN_PROFILE_SCOPE("TestAllocatingZone");
+        for (int i = 0; i < 5000; ++i) {
+            std::string text(64, 'x');
+        }
+    }
+    Profiler::SetEnabled(false);
+    Profiler::Clear();
+
+    auto sites = MemoryTracker::GetTopCallSites(MAX_MEMORY_TAGS);
+    auto zone = std::find_if(sites.begin(), sites.end(), [](const MemoryTracker::CallSite& site) {
+        return std::string(site.name) == "TestAllocatingZone";
+    });
+    ASSERT(zone != sites.end());
+    ASSERT(zone->allocations >= 5000);
+
+    // A thread's counts move to the shared slot when it exits
+    MemoryTag tag = RegisterMemoryTag("TestThread");
+    AllocationSnapshot before, after;
+    MemoryTracker::TakeSnapshot(before);
+    uint32_t slot = 0;
+    std::thread worker([&]() {
+        MemoryTagScope scope(tag);
+        slot = MemoryTracker::GetThreadSlot();
+        for (int i = 0; i < 10; ++i) {
+            std::vector<char> bytes(256);
+        }
+    });
+    worker.join();
+    MemoryTracker::TakeSnapshot(after);
+
+    AllocationSnapshot frame = after.Since(before);
+    ASSERT(slot != 0);
+    ASSERT_EQ(static_cast<int>(frame.tags[tag].allocations), 10);
+    ASSERT(frame.threads[0].allocations >= 10);
+
+    std::ostringstream report;
+    MemoryTracker::PrintReport(report, 5);
+    ASSERT(report.str().find("TestThread") != std::string::npos);
+}
+
+REGISTER_TEST(MemoryTracker_SteadyStateTicksDoNotAllocate) {
+    EntityManager em;
+    for (int i = 0; i < 500; ++i) {
+        auto id = em.CreateEntity();
+        em.AddComponent<Transform>(id);
+        em.AddComponent<RigidBody>(id).velocity = glm::vec3(1.0f, 0.0f, 0.0f);
+    }
+    SimplePhysicsSystem physics;
+    physics.SetWorld(&em, nullptr);
+
+    // The ticks below run inside the engine library; its allocations must be
+    // counted too, or a zero would prove nothing
+    AllocationSnapshot before, after;
+    uint32_t slot = MemoryTracker::GetThreadSlot();
+    EntityManager probe;
+    MemoryTracker::TakeSnapshot(before);
+    probe.CreateEntity();  // grows the slot table in Core.cpp
+    MemoryTracker::TakeSnapshot(after);
+    ASSERT(after.Since(before).threads[slot].allocations >= 1);
+
+    auto tick = [&]() {
+        physics.Update(1.0f / 60.0f);
+        float sum = 0.0f;
+        for (auto [transform] : em.GetView<const Transform>()) sum += transform.position.x;
+        return sum;
+    };
+    for (int warmup = 0; warmup < 3; ++warmup) tick();
+
+    MemoryTracker::TakeSnapshot(before);
+    for (int i = 0; i < 30; ++i) tick();
+    MemoryTracker::TakeSnapshot(after);
+
+    AllocationSnapshot frame = after.Since(before);
+    ASSERT_EQ(static_cast<int>(frame.threads[slot].allocations), 0);
+
+    // The engine's per-frame path: first call is the baseline
+    PerformanceMonitor monitor;
+    monitor.StartFrame();
+    monitor.RecordAllocations(before);
+    monitor.EndFrame();
+    monitor.StartFrame();
+    {
+        std::vector<int> garbage(10);
+        MemoryTracker::TakeSnapshot(after);
+    }
+    monitor.RecordAllocations(after);
+    monitor.EndFrame();
+    ASSERT(monitor.GetFrameAllocations().total.allocations >= 1);
+    ASSERT(monitor.GetWindowStats(PerformanceMonitor::Metric::Allocations).max >= 1.0);
+}
+
+#endif // TITAN_ALLOCATION_HOOKS
+
 // ============================================================================
 // Renderer Tests
 // ============================================================================
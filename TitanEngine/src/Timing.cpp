@@ -0,0 +1,139 @@
+#include "../include/Timing.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TITAN_CPU_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define TITAN_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+#define TITAN_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+namespace Titan {
+
+// ============================================================================
+// FixedTimestep Implementation
+// ============================================================================
+
+FixedTimestep::FixedTimestep(uint32_t tickRate, uint32_t maxTicks)
+    : step(0.0), maxTicksPerFrame(std::max<uint32_t>(1, maxTicks)) {
+    if (tickRate == 0) {
+        throw std::runtime_error("FixedTimestep needs a tick rate above zero");
+    }
+    step = 1.0 / tickRate;
+}
+
+uint32_t FixedTimestep::Advance(double frameSeconds) {
+    accumulator += std::max(0.0, frameSeconds);
+
+    uint32_t ticks = 0;
+    while (accumulator >= step && ticks < maxTicksPerFrame) {
+        accumulator -= step;
+        ++ticks;
+    }
+
+    // Drop whole ticks we cannot afford; keep the fraction so alpha stays smooth
+    if (accumulator >= step) {
+        double excess = std::floor(accumulator / step);
+        droppedTicks += static_cast<uint64_t>(excess);
+        accumulator = std::max(0.0, accumulator - excess * step);
+    }
+
+    tickCount += ticks;
+    return ticks;
+}
+
+void FixedTimestep::Reset() {
+    accumulator = 0.0;
+    tickCount = 0;
+    droppedTicks = 0;
+}
+
+// ============================================================================
+// FramePacer Implementation
+// ============================================================================
+
+using namespace std::chrono_literals;
+
+static constexpr FramePacer::Clock::duration INITIAL_SPIN_MARGIN = 2ms;
+static constexpr FramePacer::Clock::duration MIN_SPIN_MARGIN = 250us;
+
+FramePacer::FramePacer(uint32_t targetFPS)
+    : spinMargin(INITIAL_SPIN_MARGIN) {
+    SetTargetFPS(targetFPS);
+}
+
+void FramePacer::SetTargetFPS(uint32_t targetFPS) {
+    interval = targetFPS > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetFPS))
+        : Clock::duration::zero();
+    started = false;
+}
+
+void FramePacer::Start() {
+    nextDeadline = Clock::now() + interval;
+    started = true;
+}
+
+void FramePacer::WaitForNextFrame() {
+    if (interval == Clock::duration::zero()) return;
+    if (!started) Start();
+
+    Clock::time_point now = Clock::now();
+    if (now >= nextDeadline) {
+        ++missedFrames;
+        if (now - nextDeadline > interval) nextDeadline = now;
+        nextDeadline += interval;
+        return;
+    }
+
+    // Coarse sleep, leaving a margin for the OS to oversleep
+    Clock::time_point sleepUntil = nextDeadline - spinMargin;
+    if (sleepUntil > now) {
+        std::this_thread::sleep_until(sleepUntil);
+        Clock::duration oversleep = Clock::now() - sleepUntil;
+
+        // Grow at once when the OS is late, shrink slowly when it is punctual
+        Clock::duration decayed = spinMargin - spinMargin / 64;
+        spinMargin = std::min(std::max({ oversleep + MIN_SPIN_MARGIN, decayed, MIN_SPIN_MARGIN }), interval);
+    }
+
+    // Precise part
+    while ((now = Clock::now()) < nextDeadline) {
+        TITAN_CPU_PAUSE();
+    }
+
+    double errorUs = std::chrono::duration<double, std::micro>(now - nextDeadline).count();
+    ++pacedFrames;
+    double delta = errorUs - errorMean;
+    errorMean += delta / pacedFrames;
+    errorM2 += delta * (errorUs - errorMean);
+    errorMax = std::max(errorMax, errorUs);
+
+    nextDeadline += interval;
+}
+
+FramePacer::Stats FramePacer::GetStats() const {
+    Stats stats;
+    stats.frames = pacedFrames + missedFrames;
+    stats.missedFrames = missedFrames;
+    stats.meanErrorUs = errorMean;
+    stats.maxErrorUs = errorMax;
+    stats.stdDevErrorUs = pacedFrames > 1 ? std::sqrt(errorM2 / (pacedFrames - 1)) : 0.0;
+    stats.spinMarginUs = std::chrono::duration<double, std::micro>(spinMargin).count();
+    return stats;
+}
+
+void FramePacer::ResetStats() {
+    pacedFrames = 0;
+    missedFrames = 0;
+    errorMean = 0.0;
+    errorM2 = 0.0;
+    errorMax = 0.0;
+}
+
+} // namespace Titan
@@ -0,0 +1,218 @@
+#include "../include/TransformBatch.hpp"
+#include "../include/Memory.hpp"
+#include "TransformKernel.inl"
+#include "TransformBatchAVX2.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TITAN_SSE2_KERNEL 1
+#include <emmintrin.h>
+#endif
+
+#if defined(TITAN_AVX2_KERNEL) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Titan {
+
+// The AVX2 kernel writes matrices as raw floats
+static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "glm::mat4 must be 16 packed floats");
+
+namespace {
+
+// ============================================================================
+// Scalar Kernel
+// ============================================================================
+
+void ComputeModelMatricesScalar(const TransformArrays& transforms, glm::mat4* out, size_t first) {
+    for (size_t i = first; i < transforms.count; ++i) {
+        float rotation[3], scale[3], columns[9];
+        for (int k = 0; k < 3; ++k) {
+            rotation[k] = transforms.rotation[k][i];
+            scale[k] = transforms.scale[k][i];
+        }
+        ComposeLanes(rotation, scale, columns);
+
+        glm::mat4& m = out[i];
+        m[0] = glm::vec4(columns[0], columns[1], columns[2], 0.0f);
+        m[1] = glm::vec4(columns[3], columns[4], columns[5], 0.0f);
+        m[2] = glm::vec4(columns[6], columns[7], columns[8], 0.0f);
+        m[3] = glm::vec4(transforms.position[0][i], transforms.position[1][i], transforms.position[2][i], 1.0f);
+    }
+}
+
+#if defined(TITAN_SSE2_KERNEL)
+
+// ============================================================================
+// SSE2 Kernel
+// ============================================================================
+
+struct Float4 {
+    __m128 v;
+    Float4() = default;
+    Float4(__m128 value) : v(value) {}
+    Float4(float value) : v(_mm_set1_ps(value)) {}
+};
+
+struct Int4 {
+    __m128i v;
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+inline Float4 operator-(Float4 a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+inline Int4 operator+(Int4 a, int32_t b) { return Int4{ _mm_add_epi32(a.v, _mm_set1_epi32(b)) }; }
+
+inline Int4 RoundToInt(Float4 x) { return Int4{ _mm_cvtps_epi32(x.v) }; }
+inline Float4 ToFloat(Int4 q) { return _mm_cvtepi32_ps(q.v); }
+
+inline __m128 BitMask(Int4 q, int32_t bit) {
+    __m128i b = _mm_set1_epi32(bit);
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q.v, b), b));
+}
+
+inline Float4 SelectIfBit(Int4 q, int32_t bit, Float4 ifSet, Float4 ifClear) {
+    __m128 mask = BitMask(q, bit);
+    return _mm_or_ps(_mm_and_ps(mask, ifSet.v), _mm_andnot_ps(mask, ifClear.v));
+}
+
+inline Float4 NegateIfBit(Int4 q, int32_t bit, Float4 x) {
+    return _mm_xor_ps(x.v, _mm_and_ps(BitMask(q, bit), _mm_set1_ps(-0.0f)));
+}
+
+// Turns four lanes of x, y, z, w into column `column` of four matrices
+inline void StoreColumn(glm::mat4* out, int column, __m128 x, __m128 y, __m128 z, __m128 w) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(&out[0][column][0], x);
+    _mm_storeu_ps(&out[1][column][0], y);
+    _mm_storeu_ps(&out[2][column][0], z);
+    _mm_storeu_ps(&out[3][column][0], w);
+}
+
+// Returns the number of transforms handled (count rounded down to 4)
+size_t ComputeModelMatricesSSE2(const TransformArrays& transforms, glm::mat4* out) {
+    size_t i = 0;
+    for (; i + 4 <= transforms.count; i += 4) {
+        Float4 rotation[3], scale[3], columns[9];
+        for (int k = 0; k < 3; ++k) {
+            rotation[k] = _mm_loadu_ps(transforms.rotation[k] + i);
+            scale[k] = _mm_loadu_ps(transforms.scale[k] + i);
+        }
+        ComposeLanes(rotation, scale, columns);
+
+        __m128 zero = _mm_setzero_ps();
+        StoreColumn(out + i, 0, columns[0].v, columns[1].v, columns[2].v, zero);
+        StoreColumn(out + i, 1, columns[3].v, columns[4].v, columns[5].v, zero);
+        StoreColumn(out + i, 2, columns[6].v, columns[7].v, columns[8].v, zero);
+        StoreColumn(out + i, 3, _mm_loadu_ps(transforms.position[0] + i), _mm_loadu_ps(transforms.position[1] + i),
+                    _mm_loadu_ps(transforms.position[2] + i), _mm_set1_ps(1.0f));
+    }
+    return i;
+}
+
+#endif
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+bool CpuSupportsAVX2() {
+#if !defined(TITAN_AVX2_KERNEL)
+    return false;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 6) == 6);
+    if (!osSavesYmm) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+SimdLevel DetectSimdLevel() {
+    if (CpuSupportsAVX2()) return SimdLevel::AVX2;
+#if defined(TITAN_SSE2_KERNEL)
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// Public Interface
+// ============================================================================
+
+SimdLevel GetSimdLevel() {
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default: return "Scalar";
+    }
+}
+
+void ComputeModelMatrices(const TransformArrays& transforms, glm::mat4* out, SimdLevel level) {
+    level = std::min(level, GetSimdLevel());
+
+    size_t done = 0;
+#if defined(TITAN_AVX2_KERNEL)
+    if (level == SimdLevel::AVX2) {
+        ComputeModelMatricesAVX2(transforms.position, transforms.rotation, transforms.scale, transforms.count,
+                                 reinterpret_cast<float*>(out));
+        done = transforms.count & ~size_t(7);
+    }
+#endif
+#if defined(TITAN_SSE2_KERNEL)
+    if (level != SimdLevel::Scalar) {
+        TransformArrays rest = transforms;
+        for (int k = 0; k < 3; ++k) {
+            rest.position[k] += done;
+            rest.rotation[k] += done;
+            rest.scale[k] += done;
+        }
+        rest.count -= done;
+        done += ComputeModelMatricesSSE2(rest, out + done);
+    }
+#endif
+    ComputeModelMatricesScalar(transforms, out, done);
+}
+
+void ComputeModelMatrices(const Transform* transforms, size_t count, glm::mat4* out) {
+    static constexpr size_t BLOCK = 256;
+
+    LinearArena& scratch = GetThreadScratchArena();
+    ArenaScope scope(scratch);
+    Span<float> lanes = scratch.AllocateArray<float>(BLOCK * 9);
+
+    for (size_t first = 0; first < count; first += BLOCK) {
+        size_t n = std::min(BLOCK, count - first);
+        TransformArrays block;
+        for (int k = 0; k < 3; ++k) {
+            float* position = lanes.data + BLOCK * k;
+            float* rotation = lanes.data + BLOCK * (3 + k);
+            float* scale = lanes.data + BLOCK * (6 + k);
+            for (size_t i = 0; i < n; ++i) {
+                const Transform& transform = transforms[first + i];
+                position[i] = transform.position[k];
+                rotation[i] = transform.rotation[k];
+                scale[i] = transform.scale[k];
+            }
+            block.position[k] = position;
+            block.rotation[k] = rotation;
+            block.scale[k] = scale;
+        }
+        block.count = n;
+        ComputeModelMatrices(block, out + first);
+    }
+}
+
+} // namespace Titan
@@ -0,0 +1,88 @@
+// AVX2 level of the batch transform kernel. Built with AVX2 code generation
+// (see CMakeLists.txt) and only called after a runtime CPU check.
+
+#include "TransformBatchAVX2.hpp"
+
+#if defined(TITAN_AVX2_KERNEL)
+
+#include "TransformKernel.inl"
+#include <immintrin.h>
+
+namespace Titan {
+
+namespace {
+
+struct Float8 {
+    __m256 v;
+    Float8() = default;
+    Float8(__m256 value) : v(value) {}
+    Float8(float value) : v(_mm256_set1_ps(value)) {}
+};
+
+struct Int8 {
+    __m256i v;
+};
+
+inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+inline Float8 operator-(Float8 a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+inline Int8 operator+(Int8 a, int32_t b) { return Int8{ _mm256_add_epi32(a.v, _mm256_set1_epi32(b)) }; }
+
+inline Int8 RoundToInt(Float8 x) { return Int8{ _mm256_cvtps_epi32(x.v) }; }
+inline Float8 ToFloat(Int8 q) { return _mm256_cvtepi32_ps(q.v); }
+
+inline __m256 BitMask(Int8 q, int32_t bit) {
+    __m256i b = _mm256_set1_epi32(bit);
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q.v, b), b));
+}
+
+inline Float8 SelectIfBit(Int8 q, int32_t bit, Float8 ifSet, Float8 ifClear) {
+    return _mm256_blendv_ps(ifClear.v, ifSet.v, BitMask(q, bit));
+}
+
+inline Float8 NegateIfBit(Int8 q, int32_t bit, Float8 x) {
+    return _mm256_xor_ps(x.v, _mm256_and_ps(BitMask(q, bit), _mm256_set1_ps(-0.0f)));
+}
+
+// Turns eight lanes of x, y, z, w into column `column` of eight matrices
+inline void StoreColumn(float* out, int column, __m256 x, __m256 y, __m256 z, __m256 w) {
+    for (int half = 0; half < 2; ++half) {
+        __m128 hx = half ? _mm256_extractf128_ps(x, 1) : _mm256_castps256_ps128(x);
+        __m128 hy = half ? _mm256_extractf128_ps(y, 1) : _mm256_castps256_ps128(y);
+        __m128 hz = half ? _mm256_extractf128_ps(z, 1) : _mm256_castps256_ps128(z);
+        __m128 hw = half ? _mm256_extractf128_ps(w, 1) : _mm256_castps256_ps128(w);
+        _MM_TRANSPOSE4_PS(hx, hy, hz, hw);
+        float* base = out + 16 * (half * 4) + 4 * column;
+        _mm_storeu_ps(base, hx);
+        _mm_storeu_ps(base + 16, hy);
+        _mm_storeu_ps(base + 32, hz);
+        _mm_storeu_ps(base + 48, hw);
+    }
+}
+
+} // namespace
+
+void ComputeModelMatricesAVX2(const float* const position[3], const float* const rotation[3],
+                              const float* const scale[3], size_t count, float* out) {
+    for (size_t i = 0; i + 8 <= count; i += 8) {
+        Float8 rotationLanes[3], scaleLanes[3], columns[9];
+        for (int k = 0; k < 3; ++k) {
+            rotationLanes[k] = _mm256_loadu_ps(rotation[k] + i);
+            scaleLanes[k] = _mm256_loadu_ps(scale[k] + i);
+        }
+        ComposeLanes(rotationLanes, scaleLanes, columns);
+
+        float* matrices = out + 16 * i;
+        __m256 zero = _mm256_setzero_ps();
+        StoreColumn(matrices, 0, columns[0].v, columns[1].v, columns[2].v, zero);
+        StoreColumn(matrices, 1, columns[3].v, columns[4].v, columns[5].v, zero);
+        StoreColumn(matrices, 2, columns[6].v, columns[7].v, columns[8].v, zero);
+        StoreColumn(matrices, 3, _mm256_loadu_ps(position[0] + i), _mm256_loadu_ps(position[1] + i),
+                    _mm256_loadu_ps(position[2] + i), _mm256_set1_ps(1.0f));
+    }
+}
+
+} // namespace Titan
+
+#endif
@@ -0,0 +1,17 @@
+// Entry point of the AVX2 level of the batch transform kernel. Kept free of
+// Core.hpp and glm on purpose: every inline function the AVX2 object
+// instantiates is compiled for AVX2, and the linker may keep that copy for
+// the whole library, so this interface is raw floats only.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Titan {
+
+// Same structure-of-arrays input as TransformArrays. Writes count rounded
+// down to 8 column-major 4x4 matrices, 16 floats each, to out.
+void ComputeModelMatricesAVX2(const float* const position[3], const float* const rotation[3],
+                              const float* const scale[3], size_t count, float* out);
+
+} // namespace Titan
@@ -0,0 +1,78 @@
+// Lane-generic body of the batch transform kernel, shared by
+// TransformBatch.cpp (scalar, SSE2) and TransformBatchAVX2.cpp. F is float or
+// a SIMD wrapper providing + - * and unary -, plus RoundToInt, ToFloat,
+// SelectIfBit and NegateIfBit overloads. Every level evaluates exactly the
+// same operations in the same order, which is what makes their results
+// bit-identical; keep it that way (and keep FP contraction off).
+//
+// Everything here has internal linkage so each translation unit gets its own
+// instantiations, compiled for its own instruction set.
+
+#include <cmath>
+#include <cstdint>
+
+namespace Titan {
+namespace {
+
+constexpr float TWO_OVER_PI = 0.636619772367581343f;
+
+// pi/2 split so that q * PIO2_HI is exact for |q| < 2^15
+constexpr float PIO2_HI = 1.5703125f;
+constexpr float PIO2_MID = 4.837512969970703125e-4f;
+constexpr float PIO2_LO = 7.54978995489188216e-8f;
+
+// Minimax polynomials on [-pi/4, pi/4] (Cephes sinf/cosf)
+constexpr float SIN_C0 = -1.6666654611e-1f;
+constexpr float SIN_C1 = 8.3321608736e-3f;
+constexpr float SIN_C2 = -1.9515295891e-4f;
+constexpr float COS_C0 = 4.166664568298827e-2f;
+constexpr float COS_C1 = -1.388731625493765e-3f;
+constexpr float COS_C2 = 2.443315711809948e-5f;
+
+// Scalar lane. nearbyint rounds half to even, like cvtps2dq.
+inline int32_t RoundToInt(float x) { return static_cast<int32_t>(std::nearbyint(x)); }
+inline float ToFloat(int32_t q) { return static_cast<float>(q); }
+inline float SelectIfBit(int32_t q, int32_t bit, float ifSet, float ifClear) { return (q & bit) ? ifSet : ifClear; }
+inline float NegateIfBit(int32_t q, int32_t bit, float x) { return (q & bit) ? -x : x; }
+
+template<typename F>
+inline void SinCosLanes(F x, F& sine, F& cosine) {
+    // Reduce to r in [-pi/4, pi/4], x = r + q * pi/2
+    auto q = RoundToInt(x * F(TWO_OVER_PI));
+    F qf = ToFloat(q);
+    F r = x - qf * F(PIO2_HI);
+    r = r - qf * F(PIO2_MID);
+    r = r - qf * F(PIO2_LO);
+
+    F z = r * r;
+    F sinR = ((F(SIN_C2) * z + F(SIN_C1)) * z + F(SIN_C0)) * (z * r) + r;
+    F cosR = F(1.0f) - F(0.5f) * z + ((F(COS_C2) * z + F(COS_C1)) * z + F(COS_C0)) * (z * z);
+
+    // Odd quadrants swap sin and cos; the sign follows the quadrant
+    sine = NegateIfBit(q, 2, SelectIfBit(q, 1, cosR, sinR));
+    cosine = NegateIfBit(q + 1, 2, SelectIfBit(q, 1, sinR, cosR));
+}
+
+// Upper 3x3 of the model matrix, column by column (x, y, z of each column)
+template<typename F>
+inline void ComposeLanes(const F rotation[3], const F scale[3], F out[9]) {
+    F sinX, cosX, sinY, cosY, sinZ, cosZ;
+    SinCosLanes(rotation[0], sinX, cosX);
+    SinCosLanes(rotation[1], sinY, cosY);
+    SinCosLanes(rotation[2], sinZ, cosZ);
+
+    out[0] = cosZ * cosY * scale[0];
+    out[1] = sinZ * cosY * scale[0];
+    out[2] = -sinY * scale[0];
+
+    out[3] = (cosZ * sinY * sinX - cosX * sinZ) * scale[1];
+    out[4] = (cosZ * cosX + sinZ * sinY * sinX) * scale[1];
+    out[5] = cosY * sinX * scale[1];
+
+    out[6] = (cosZ * cosX * sinY + sinZ * sinX) * scale[2];
+    out[7] = (cosX * sinZ * sinY - cosZ * sinX) * scale[2];
+    out[8] = cosY * cosX * scale[2];
+}
+
+} // namespace
+} // namespace Titan
@@ -155,20 +155,32 @@ void SimpleNetworkManager::Disconnect() {
 }
 
 void SimpleNetworkManager::SendMessage(const NetMessage& message, bool reliable) {
+    ++stats.messagesSent;
+    stats.bytesSent += message.data.size();
     std::cout << "Sending message from player " << message.senderID << std::endl;
 }
 
 void SimpleNetworkManager::BroadcastMessage(const NetMessage& message, bool reliable) {
+    stats.messagesSent += players.size();
+    stats.bytesSent += message.data.size() * players.size();
     std::cout << "Broadcasting message type " << static_cast<int>(message.type) << std::endl;
 }
 
 std::vector<NetMessage> SimpleNetworkManager::ReceiveMessages() {
     std::vector<NetMessage> messages;
+    ReceiveMessages(messages);
+    return messages;
+}
+
+size_t SimpleNetworkManager::ReceiveMessages(std::vector<NetMessage>& out) {
+    size_t count = incomingMessages.size();
     while (!incomingMessages.empty()) {
-        messages.push_back(incomingMessages.front());
+        ++stats.messagesReceived;
+        stats.bytesReceived += incomingMessages.front().data.size();
+        out.push_back(std::move(incomingMessages.front()));
         incomingMessages.pop_front();
     }
-    return messages;
+    return count;
 }
 
 std::shared_ptr<NetworkPlayer> SimpleNetworkManager::GetPlayer(uint32_t playerID) {